@@ -37,5 +37,11 @@ void App::DrawDemo() {
     renderer.scene->DrawRectangle(100, 100, 200, 200, {0, 0, 0});
     renderer.scene->DrawRectangle(120, 120, 160, 160, {255, 128, 128});
     renderer.scene->DrawRectangle(140, 140, 120, 120, {0, 0, 0});
-    renderer.scene->DrawText("Hello, Screen!", renderer.font, 400, 220, {50, 50, 50}, {0, 0, 255});
+    if (renderer.FontsReady()) {
+        renderer.scene->DrawText("Hello, Screen!", renderer.font, 400, 220, {50, 50, 50},
+                                 {0, 0, 255});
+    } else {
+        renderer.scene->DrawText("Loading...", FindBakedFont(32), 400, 220, {50, 50, 50},
+                                 {0, 0, 255});
+    }
 }
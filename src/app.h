@@ -29,5 +29,6 @@ public:
     s32 user_id{};
     Pad pad{};
 
-    Renderer renderer{};
+    // The first frames don't wait for the system font, see DrawDemo
+    Renderer renderer{FontLoading::Background};
 };
@@ -21,10 +21,12 @@ void assert_fail_impl() {
     throw std::runtime_error("Unreachable code");
 }
 
+#ifndef HOST_BUILD
 extern "C"
 void __cxa_thread_atexit_impl() {
     // LOG_INFO("Atexit called");
 }
+#endif
 
 void assert_fail_debug_msg(const char* msg) {
     LOG_CRITICAL("Assertion failed: {}", msg);
@@ -0,0 +1,72 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "assert.h"
+#include "baked_font.h"
+#include "baked_font_data.h"
+
+const BakedGlyph* BakedFont::Find(char32_t codepoint) const {
+    auto it = std::lower_bound(
+        this->glyphs.begin(), this->glyphs.end(), codepoint,
+        [](const BakedGlyph& glyph, char32_t value) { return glyph.codepoint < value; });
+    return it != this->glyphs.end() && it->codepoint == codepoint ? &*it : nullptr;
+}
+
+int BakedFont::Kerning(char32_t left, char32_t right) const {
+    auto it = std::lower_bound(this->kerning.begin(), this->kerning.end(), std::pair{left, right},
+                               [](const BakedKerning& pair, std::pair<char32_t, char32_t> value) {
+                                   return std::pair{pair.left, pair.right} < value;
+                               });
+    return it != this->kerning.end() && it->left == left && it->right == right ? it->x : 0;
+}
+
+std::span<const BakedFont> BakedFonts() {
+    return kBakedFonts;
+}
+
+const BakedFont& FindBakedFont(int pixelSize) {
+    std::span<const BakedFont> const fonts = BakedFonts();
+    ASSERT(!fonts.empty());
+    const BakedFont* best = &fonts[0];
+    for (const BakedFont& font : fonts) {
+        if (std::abs(font.pixelSize - pixelSize) < std::abs(best->pixelSize - pixelSize)) {
+            best = &font;
+        }
+    }
+    return *best;
+}
+
+TextMetrics MeasureText(std::string_view txt, const BakedFont& font) {
+    FontMetrics const& metrics = font.metrics;
+    TextMetrics result{0, 0, metrics.ascent, metrics.descent, metrics.lineGap, metrics.lineHeight,
+                       1};
+
+    // The pen moves as in RenderBakedGlyphs
+    int penX = 0;
+    char32_t previous = 0;
+    for (size_t pos = 0; pos < txt.size();) {
+        char32_t const codepoint = DecodeUtf8(txt, pos);
+        if (codepoint == U'\n') {
+            penX = 0;
+            previous = 0;
+            result.lines++;
+            continue;
+        }
+
+        const BakedGlyph* glyph = font.Find(codepoint);
+        if (!glyph)
+            continue;
+
+        if (previous != 0) {
+            penX += font.Kerning(previous, codepoint);
+        }
+        previous = codepoint;
+        penX += glyph->advance;
+        result.width = std::max(result.width, penX);
+    }
+
+    result.height = metrics.ascent + metrics.descent + (result.lines - 1) * metrics.lineHeight;
+    return result;
+}
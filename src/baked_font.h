@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <span>
+#include <string_view>
+
+#include "text.h"
+#include "utf8.h"
+
+// A glyph rasterized at build time. Its coverage is `width` x `height` bytes, packed.
+struct BakedGlyph {
+    char32_t codepoint;
+    int16_t left; // from the pen position to the bitmap's left edge
+    int16_t top;  // from the baseline up to the bitmap's top edge
+    uint8_t width;
+    uint8_t height;
+    uint8_t advance;
+    uint32_t offset; // into BakedFont::coverage
+};
+
+// Adjusts the advance between two glyphs, in whole pixels
+struct BakedKerning {
+    char32_t left;
+    char32_t right;
+    int8_t x;
+};
+
+// A font at one pixel size, rasterized by the bake_font host tool into baked_font_data.h and
+// compiled into the executable, so text can be drawn before (or without) FreeType being loaded.
+// Only the baked glyph set exists; other codepoints are skipped.
+struct BakedFont {
+    int pixelSize;
+    FontMetrics metrics;
+    std::span<const BakedGlyph> glyphs;     // sorted by codepoint
+    std::span<const BakedKerning> kerning;  // sorted by pair
+    const uint8_t* coverage;
+
+    const BakedGlyph* Find(char32_t codepoint) const;
+    int Kerning(char32_t left, char32_t right) const;
+};
+
+// Every baked size, smallest first
+std::span<const BakedFont> BakedFonts();
+// The baked size closest to `pixelSize`
+const BakedFont& FindBakedFont(int pixelSize);
+
+TextMetrics MeasureText(std::string_view txt, const BakedFont& font);
+
+// Walks UTF-8 text like RenderGlyphs, with glyphs from a baked font, calling
+// fn(const BakedGlyph& glyph, int x, int y) with the screen position of each glyph's top-left
+// corner. The pen moves the way TextPen moves it.
+template <typename Fn>
+void RenderBakedGlyphs(std::string_view txt, const BakedFont& font, int startX, int startY,
+                       Fn&& fn) {
+    int penX = 0;
+    int penY = 0;
+    char32_t previous = 0;
+    for (size_t pos = 0; pos < txt.size();) {
+        char32_t const codepoint = DecodeUtf8(txt, pos);
+        if (codepoint == U'\n') {
+            penX = 0;
+            penY += font.metrics.lineHeight;
+            previous = 0;
+            continue;
+        }
+
+        const BakedGlyph* glyph = font.Find(codepoint);
+        if (!glyph)
+            continue;
+
+        if (previous != 0) {
+            penX += font.Kerning(previous, codepoint);
+        }
+        previous = codepoint;
+        fn(*glyph, startX + penX + glyph->left, startY + penY - glyph->top);
+        penX += glyph->advance;
+    }
+}
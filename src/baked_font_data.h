@@ -0,0 +1,2308 @@
+// Generated by bake_font from DejaVuSans.ttf, do not edit.
+#pragma once
+
+#include "baked_font.h"
+
+static constexpr uint8_t kBakedCoverage32[] = {
+    44, 255, 255, 255, 44, 255, 255, 255, 44, 255, 255, 255, 44, 255, 255, 255,
+    44, 255, 255, 255, 44, 255, 255, 255, 44, 255, 255, 255, 44, 255, 255, 255,
+    44, 255, 255, 255, 43, 255, 255, 255, 32, 255, 255, 243, 16, 255, 255, 228,
+    1, 253, 255, 213, 0, 240, 255, 198, 0, 224, 255, 183, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 255, 255, 255,
+    44, 255, 255, 255, 44, 255, 255, 255, 44, 255, 255, 255, 236, 255, 188, 0,
+    0, 4, 255, 255, 164, 236, 255, 188, 0, 0, 4, 255, 255, 164, 236, 255,
+    188, 0, 0, 4, 255, 255, 164, 236, 255, 188, 0, 0, 4, 255, 255, 164,
+    236, 255, 188, 0, 0, 4, 255, 255, 164, 236, 255, 188, 0, 0, 4, 255,
+    255, 164, 236, 255, 188, 0, 0, 4, 255, 255, 164, 236, 255, 188, 0, 0,
+    4, 255, 255, 164, 236, 255, 188, 0, 0, 4, 255, 255, 164, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 167, 255, 224, 0, 0, 0, 0, 140, 255, 241,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 233, 255, 155,
+    0, 0, 0, 0, 210, 255, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 47, 255, 255, 86, 0, 0, 0, 24, 255, 255, 107, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 255, 253, 19, 0, 0,
+    0, 94, 255, 255, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 183, 255, 203, 0, 0, 0, 0, 164, 255, 226, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 244, 255, 134, 0, 0, 0, 1, 232,
+    255, 158, 0, 0, 0, 0, 0, 0, 0, 192, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 92, 0, 0,
+    192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 92, 0, 0, 192, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 92, 0, 0, 0, 0,
+    0, 0, 0, 218, 255, 173, 0, 0, 0, 0, 197, 255, 190, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 255, 255, 106, 0, 0, 0,
+    11, 250, 255, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    96, 255, 255, 39, 0, 0, 0, 72, 255, 255, 59, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 163, 255, 228, 0, 0, 0, 0, 138, 255,
+    244, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 229, 255,
+    161, 0, 0, 0, 0, 203, 255, 184, 0, 0, 0, 0, 0, 0, 0, 136,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 144, 0, 0, 136, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 144, 0, 0, 136, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 144, 0, 0, 0, 0, 0, 0, 0, 191, 255, 193, 0, 0, 0, 0,
+    171, 255, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    249, 255, 124, 0, 0, 0, 2, 236, 255, 147, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 74, 255, 255, 55, 0, 0, 0, 52, 255, 255,
+    78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 255, 240,
+    3, 0, 0, 0, 121, 255, 251, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 212, 255, 174, 0, 0, 0, 0, 189, 255, 195, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 255, 255, 106, 0, 0,
+    0, 9, 248, 255, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 209, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 15, 112, 186, 230, 254, 255, 246, 217, 184, 123, 53, 2, 0, 0, 0,
+    82, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 72, 0, 0, 71,
+    252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 72, 0, 0, 217,
+    255, 255, 233, 110, 37, 192, 208, 19, 46, 76, 136, 204, 69, 0, 44, 255,
+    255, 239, 34, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 78, 255,
+    255, 164, 0, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 76, 255,
+    255, 157, 0, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 34, 255,
+    255, 232, 22, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 0, 194,
+    255, 255, 219, 98, 23, 192, 208, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+    232, 255, 255, 255, 255, 253, 238, 132, 78, 11, 0, 0, 0, 0, 0, 0,
+    24, 163, 252, 255, 255, 255, 255, 255, 255, 247, 157, 30, 0, 0, 0, 0,
+    0, 0, 23, 102, 163, 241, 255, 255, 255, 255, 255, 241, 66, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 214, 66, 134, 232, 255, 255, 239, 21, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 15, 206, 255, 255, 116, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 0, 81, 255, 255, 165, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 0, 64, 255, 255, 170, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 3, 177, 255, 255, 135, 83, 190,
+    120, 64, 30, 8, 0, 192, 208, 35, 96, 209, 255, 255, 255, 51, 88, 255,
+    255, 255, 255, 255, 243, 249, 255, 255, 255, 255, 255, 255, 149, 0, 88, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 134, 2, 0, 3, 48,
+    105, 162, 199, 220, 241, 255, 254, 231, 191, 126, 31, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 196, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 195, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 194, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 193, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 192, 208, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 76, 188, 239, 246, 209, 117, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 29, 243, 255, 110, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255,
+    255, 255, 255, 195, 11, 0, 0, 0, 0, 0, 0, 0, 0, 179, 255, 201,
+    2, 0, 0, 0, 0, 0, 0, 67, 255, 255, 169, 29, 13, 116, 254, 255,
+    146, 0, 0, 0, 0, 0, 0, 0, 86, 255, 251, 46, 0, 0, 0, 0,
+    0, 0, 0, 188, 255, 226, 5, 0, 0, 0, 160, 255, 248, 19, 0, 0,
+    0, 0, 0, 16, 231, 255, 135, 0, 0, 0, 0, 0, 0, 0, 9, 251,
+    255, 131, 0, 0, 0, 0, 58, 255, 255, 84, 0, 0, 0, 0, 0, 155,
+    255, 219, 9, 0, 0, 0, 0, 0, 0, 0, 44, 255, 255, 89, 0, 0,
+    0, 0, 15, 255, 255, 122, 0, 0, 0, 0, 62, 254, 255, 66, 0, 0,
+    0, 0, 0, 0, 0, 0, 56, 255, 255, 70, 0, 0, 0, 0, 0, 250,
+    255, 135, 0, 0, 0, 7, 216, 255, 159, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 43, 255, 255, 90, 0, 0, 0, 0, 15, 255, 255, 122, 0, 0,
+    0, 131, 255, 234, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 251,
+    255, 130, 0, 0, 0, 0, 56, 255, 255, 83, 0, 0, 42, 249, 255, 91,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190, 255, 224, 4, 0,
+    0, 0, 157, 255, 248, 20, 0, 1, 197, 255, 184, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 72, 255, 255, 165, 27, 12, 111, 253, 255,
+    148, 0, 0, 106, 255, 245, 32, 0, 0, 63, 181, 237, 248, 216, 131, 12,
+    0, 0, 0, 0, 135, 255, 255, 255, 255, 255, 255, 198, 12, 0, 26, 241,
+    255, 115, 0, 0, 107, 254, 255, 255, 255, 255, 255, 210, 20, 0, 0, 0,
+    0, 81, 191, 241, 247, 211, 120, 8, 0, 0, 175, 255, 205, 3, 0, 48,
+    251, 255, 188, 37, 10, 96, 249, 255, 169, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 81, 255, 252, 50, 0, 0, 165, 255, 243, 15, 0,
+    0, 0, 135, 255, 254, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 228, 255, 140, 0, 0, 0, 236, 255, 159, 0, 0, 0, 0, 33, 255,
+    255, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 150, 255, 223, 10,
+    0, 0, 19, 255, 255, 118, 0, 0, 0, 0, 0, 246, 255, 146, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 58, 254, 255, 72, 0, 0, 0, 32, 255,
+    255, 98, 0, 0, 0, 0, 0, 227, 255, 159, 0, 0, 0, 0, 0, 0,
+    0, 0, 5, 212, 255, 165, 0, 0, 0, 0, 20, 255, 255, 117, 0, 0,
+    0, 0, 0, 246, 255, 146, 0, 0, 0, 0, 0, 0, 0, 0, 125, 255,
+    237, 21, 0, 0, 0, 0, 0, 236, 255, 159, 0, 0, 0, 0, 32, 255,
+    255, 108, 0, 0, 0, 0, 0, 0, 0, 39, 248, 255, 96, 0, 0, 0,
+    0, 0, 0, 166, 255, 243, 15, 0, 0, 0, 134, 255, 254, 37, 0, 0,
+    0, 0, 0, 0, 1, 192, 255, 189, 0, 0, 0, 0, 0, 0, 0, 49,
+    252, 255, 188, 36, 9, 95, 249, 255, 170, 0, 0, 0, 0, 0, 0, 0,
+    101, 255, 247, 36, 0, 0, 0, 0, 0, 0, 0, 0, 108, 255, 255, 255,
+    255, 255, 255, 211, 20, 0, 0, 0, 0, 0, 0, 23, 238, 255, 121, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 181, 237, 248, 217, 131, 12,
+    0, 0, 0, 0, 0, 0, 0, 67, 166, 222, 246, 243, 218, 190, 125, 52,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 164, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 147, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 56, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 251, 255, 255, 206, 83, 25, 5, 22, 65,
+    132, 204, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 255, 255, 225,
+    11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 70, 255, 255, 173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 16, 248, 255, 234, 16, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139,
+    255, 255, 195, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 20, 244, 255, 255, 212, 27, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 213, 255, 255, 255, 255,
+    222, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+    220, 255, 246, 74, 169, 255, 255, 228, 40, 0, 0, 0, 0, 0, 0, 24,
+    255, 255, 201, 0, 0, 183, 255, 255, 83, 0, 3, 165, 255, 255, 234, 48,
+    0, 0, 0, 0, 0, 56, 255, 255, 156, 0, 74, 255, 255, 170, 0, 0,
+    0, 2, 161, 255, 255, 239, 56, 0, 0, 0, 0, 115, 255, 255, 89, 0,
+    173, 255, 255, 67, 0, 0, 0, 0, 2, 157, 255, 255, 243, 65, 0, 0,
+    0, 194, 255, 246, 12, 0, 230, 255, 255, 21, 0, 0, 0, 0, 0, 1,
+    152, 255, 255, 247, 74, 0, 46, 255, 255, 146, 0, 0, 246, 255, 255, 22,
+    0, 0, 0, 0, 0, 0, 1, 148, 255, 255, 250, 85, 187, 255, 246, 25,
+    0, 0, 228, 255, 255, 79, 0, 0, 0, 0, 0, 0, 0, 0, 143, 255,
+    255, 254, 255, 255, 112, 0, 0, 0, 178, 255, 255, 201, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 139, 255, 255, 255, 207, 1, 0, 0, 0, 88, 255,
+    255, 255, 166, 9, 0, 0, 0, 0, 0, 0, 4, 129, 255, 255, 255, 251,
+    68, 0, 0, 0, 1, 199, 255, 255, 255, 218, 104, 34, 6, 13, 46, 115,
+    222, 255, 255, 246, 255, 255, 238, 37, 0, 0, 0, 24, 219, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 214, 34, 182, 255, 255, 215, 15, 0,
+    0, 0, 18, 171, 255, 255, 255, 255, 255, 255, 255, 255, 252, 149, 15, 0,
+    24, 235, 255, 255, 183, 3, 0, 0, 0, 0, 47, 143, 205, 237, 250, 232,
+    201, 128, 38, 0, 0, 0, 0, 81, 255, 255, 255, 142, 236, 255, 188, 236,
+    255, 188, 236, 255, 188, 236, 255, 188, 236, 255, 188, 236, 255, 188, 236, 255,
+    188, 236, 255, 188, 236, 255, 188, 0, 0, 0, 0, 6, 217, 255, 166, 0,
+    0, 0, 0, 119, 255, 250, 35, 0, 0, 0, 17, 240, 255, 160, 0, 0,
+    0, 0, 134, 255, 255, 42, 0, 0, 0, 12, 239, 255, 193, 0, 0, 0,
+    0, 106, 255, 255, 95, 0, 0, 0, 0, 202, 255, 250, 17, 0, 0, 0,
+    34, 255, 255, 191, 0, 0, 0, 0, 108, 255, 255, 127, 0, 0, 0, 0,
+    172, 255, 255, 72, 0, 0, 0, 0, 224, 255, 255, 28, 0, 0, 0, 9,
+    255, 255, 249, 1, 0, 0, 0, 38, 255, 255, 224, 0, 0, 0, 0, 54,
+    255, 255, 212, 0, 0, 0, 0, 61, 255, 255, 206, 0, 0, 0, 0, 54,
+    255, 255, 212, 0, 0, 0, 0, 38, 255, 255, 225, 0, 0, 0, 0, 8,
+    254, 255, 250, 1, 0, 0, 0, 0, 223, 255, 255, 29, 0, 0, 0, 0,
+    172, 255, 255, 73, 0, 0, 0, 0, 108, 255, 255, 127, 0, 0, 0, 0,
+    34, 255, 255, 191, 0, 0, 0, 0, 0, 202, 255, 250, 17, 0, 0, 0,
+    0, 106, 255, 255, 96, 0, 0, 0, 0, 11, 239, 255, 194, 0, 0, 0,
+    0, 0, 133, 255, 255, 43, 0, 0, 0, 0, 17, 240, 255, 160, 0, 0,
+    0, 0, 0, 119, 255, 250, 34, 0, 0, 0, 0, 6, 217, 255, 167, 46,
+    253, 255, 90, 0, 0, 0, 0, 0, 163, 255, 229, 12, 0, 0, 0, 0,
+    40, 254, 255, 124, 0, 0, 0, 0, 0, 177, 255, 239, 15, 0, 0, 0,
+    0, 74, 255, 255, 116, 0, 0, 0, 0, 2, 229, 255, 224, 2, 0, 0,
+    0, 0, 149, 255, 255, 65, 0, 0, 0, 0, 71, 255, 255, 153, 0, 0,
+    0, 0, 12, 251, 255, 227, 0, 0, 0, 0, 0, 207, 255, 255, 37, 0,
+    0, 0, 0, 161, 255, 255, 90, 0, 0, 0, 0, 128, 255, 255, 130, 0,
+    0, 0, 0, 102, 255, 255, 161, 0, 0, 0, 0, 89, 255, 255, 177, 0,
+    0, 0, 0, 82, 255, 255, 185, 0, 0, 0, 0, 90, 255, 255, 176, 0,
+    0, 0, 0, 103, 255, 255, 160, 0, 0, 0, 0, 129, 255, 255, 130, 0,
+    0, 0, 0, 162, 255, 255, 89, 0, 0, 0, 0, 208, 255, 255, 37, 0,
+    0, 0, 12, 251, 255, 227, 0, 0, 0, 0, 71, 255, 255, 153, 0, 0,
+    0, 0, 148, 255, 255, 66, 0, 0, 0, 2, 228, 255, 225, 2, 0, 0,
+    0, 73, 255, 255, 117, 0, 0, 0, 0, 176, 255, 240, 16, 0, 0, 0,
+    40, 254, 255, 125, 0, 0, 0, 0, 162, 255, 229, 12, 0, 0, 0, 45,
+    253, 255, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 228,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 228,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 147, 11, 0, 0, 0, 228, 228,
+    0, 0, 0, 11, 147, 102, 0, 0, 214, 255, 222, 65, 0, 0, 228, 228,
+    0, 0, 66, 222, 255, 213, 0, 0, 20, 154, 253, 254, 151, 13, 228, 228,
+    13, 151, 254, 253, 154, 20, 0, 0, 0, 0, 51, 199, 255, 225, 243, 243,
+    225, 255, 198, 51, 0, 0, 0, 0, 0, 0, 0, 1, 95, 232, 255, 255,
+    232, 95, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 94, 231, 255, 255,
+    231, 94, 1, 0, 0, 0, 0, 0, 0, 0, 49, 197, 255, 225, 243, 243,
+    225, 255, 197, 49, 0, 0, 0, 0, 18, 150, 253, 254, 152, 13, 228, 228,
+    13, 152, 254, 253, 150, 18, 0, 0, 213, 255, 222, 66, 0, 0, 228, 228,
+    0, 0, 66, 222, 255, 212, 0, 0, 103, 148, 11, 0, 0, 0, 228, 228,
+    0, 0, 0, 12, 148, 103, 0, 0, 0, 0, 0, 0, 0, 0, 228, 228,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 228,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232,
+    255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255,
+    184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 156, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 108, 156, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108, 156, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 184, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 184, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 184, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232,
+    255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 232, 255, 184, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 64, 255, 255, 255, 12, 0, 64, 255, 255, 255, 12, 0, 65, 255, 255,
+    255, 10, 0, 108, 255, 255, 179, 0, 0, 171, 255, 255, 53, 0, 0, 233,
+    255, 183, 0, 0, 41, 255, 255, 57, 0, 0, 104, 255, 187, 0, 0, 0,
+    112, 255, 255, 255, 255, 255, 255, 255, 252, 112, 255, 255, 255, 255, 255, 255,
+    255, 252, 112, 255, 255, 255, 255, 255, 255, 255, 252, 148, 255, 255, 184, 148,
+    255, 255, 184, 148, 255, 255, 184, 148, 255, 255, 184, 0, 0, 0, 0, 0,
+    0, 0, 14, 249, 255, 159, 0, 0, 0, 0, 0, 0, 0, 89, 255, 255,
+    79, 0, 0, 0, 0, 0, 0, 0, 169, 255, 245, 9, 0, 0, 0, 0,
+    0, 0, 6, 241, 255, 175, 0, 0, 0, 0, 0, 0, 0, 73, 255, 255,
+    95, 0, 0, 0, 0, 0, 0, 0, 153, 255, 252, 19, 0, 0, 0, 0,
+    0, 0, 1, 230, 255, 191, 0, 0, 0, 0, 0, 0, 0, 57, 255, 255,
+    111, 0, 0, 0, 0, 0, 0, 0, 137, 255, 255, 32, 0, 0, 0, 0,
+    0, 0, 0, 216, 255, 207, 0, 0, 0, 0, 0, 0, 0, 40, 255, 255,
+    127, 0, 0, 0, 0, 0, 0, 0, 121, 255, 255, 47, 0, 0, 0, 0,
+    0, 0, 0, 201, 255, 223, 0, 0, 0, 0, 0, 0, 0, 25, 254, 255,
+    143, 0, 0, 0, 0, 0, 0, 0, 105, 255, 255, 63, 0, 0, 0, 0,
+    0, 0, 0, 185, 255, 236, 3, 0, 0, 0, 0, 0, 0, 14, 249, 255,
+    159, 0, 0, 0, 0, 0, 0, 0, 89, 255, 255, 79, 0, 0, 0, 0,
+    0, 0, 0, 169, 255, 245, 9, 0, 0, 0, 0, 0, 0, 6, 241, 255,
+    175, 0, 0, 0, 0, 0, 0, 0, 73, 255, 255, 95, 0, 0, 0, 0,
+    0, 0, 0, 153, 255, 252, 19, 0, 0, 0, 0, 0, 0, 1, 230, 255,
+    191, 0, 0, 0, 0, 0, 0, 0, 57, 255, 255, 111, 0, 0, 0, 0,
+    0, 0, 0, 137, 255, 255, 32, 0, 0, 0, 0, 0, 0, 0, 216, 255,
+    207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 135, 209,
+    238, 246, 221, 165, 72, 0, 0, 0, 0, 0, 0, 0, 0, 109, 247, 255,
+    255, 255, 255, 255, 255, 255, 172, 13, 0, 0, 0, 0, 0, 108, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 186, 5, 0, 0, 0, 38, 251, 255,
+    255, 224, 88, 20, 10, 56, 177, 255, 255, 255, 117, 0, 0, 0, 169, 255,
+    255, 227, 22, 0, 0, 0, 0, 0, 160, 255, 255, 239, 14, 0, 14, 248,
+    255, 255, 85, 0, 0, 0, 0, 0, 0, 13, 239, 255, 255, 92, 0, 87,
+    255, 255, 233, 3, 0, 0, 0, 0, 0, 0, 0, 148, 255, 255, 173, 0,
+    136, 255, 255, 169, 0, 0, 0, 0, 0, 0, 0, 0, 78, 255, 255, 222,
+    0, 179, 255, 255, 125, 0, 0, 0, 0, 0, 0, 0, 0, 35, 255, 255,
+    254, 11, 203, 255, 255, 94, 0, 0, 0, 0, 0, 0, 0, 0, 4, 255,
+    255, 255, 33, 216, 255, 255, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    247, 255, 255, 46, 225, 255, 255, 74, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 239, 255, 255, 56, 216, 255, 255, 81, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 247, 255, 255, 46, 203, 255, 255, 94, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 255, 255, 255, 33, 179, 255, 255, 125, 0, 0, 0, 0, 0,
+    0, 0, 0, 35, 255, 255, 254, 11, 137, 255, 255, 169, 0, 0, 0, 0,
+    0, 0, 0, 0, 78, 255, 255, 223, 0, 87, 255, 255, 233, 3, 0, 0,
+    0, 0, 0, 0, 0, 148, 255, 255, 174, 0, 14, 249, 255, 255, 85, 0,
+    0, 0, 0, 0, 0, 13, 239, 255, 255, 93, 0, 0, 171, 255, 255, 227,
+    21, 0, 0, 0, 0, 0, 160, 255, 255, 240, 15, 0, 0, 39, 251, 255,
+    255, 224, 87, 19, 10, 55, 177, 255, 255, 255, 119, 0, 0, 0, 0, 111,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 189, 6, 0, 0, 0, 0,
+    0, 112, 247, 255, 255, 255, 255, 255, 255, 255, 175, 14, 0, 0, 0, 0,
+    0, 0, 0, 37, 137, 210, 239, 246, 222, 166, 73, 0, 0, 0, 0, 0,
+    5, 45, 91, 136, 182, 228, 255, 255, 255, 64, 0, 0, 0, 0, 0, 124,
+    255, 255, 255, 255, 255, 255, 255, 255, 64, 0, 0, 0, 0, 0, 124, 255,
+    255, 255, 255, 255, 255, 255, 255, 64, 0, 0, 0, 0, 0, 118, 211, 166,
+    120, 74, 29, 224, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 224, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 224, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    224, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224,
+    255, 255, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 255,
+    255, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 255, 255,
+    64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 255, 255, 64,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 255, 255, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 255, 255, 64, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 255, 255, 64, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 224, 255, 255, 64, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 224, 255, 255, 64, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 224, 255, 255, 64, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 224, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 224, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 224, 255, 255, 64, 0, 0, 0, 0, 0, 8, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 8, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 8, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 104, 6, 53, 107, 161, 205, 234, 248,
+    249, 232, 191, 127, 30, 0, 0, 0, 0, 128, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 250, 132, 3, 0, 0, 128, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 163, 0, 0, 121, 202, 147, 92, 54, 34, 14,
+    7, 38, 118, 240, 255, 255, 255, 86, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 36, 234, 255, 255, 191, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 108, 255, 255, 242, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 46, 255, 255, 253, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 59, 255, 255, 228, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 137, 255, 255, 157, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 33, 243, 255, 251, 41, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 200, 255, 255, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 178, 255, 255, 187, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 171, 255, 255, 198, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    179, 255, 255, 196, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 190,
+    255, 255, 193, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 202, 255,
+    255, 189, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 213, 255, 255,
+    183, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 223, 255, 255, 178,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 230, 255, 255, 171, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 236, 255, 255, 164, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 168, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 40, 168, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 40, 168, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 40, 0, 21, 77, 134, 187, 213, 234,
+    251, 240, 214, 165, 84, 5, 0, 0, 0, 0, 220, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 215, 54, 0, 0, 0, 220, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 245, 50, 0, 0, 195, 165, 110, 64, 39, 16,
+    4, 21, 69, 164, 255, 255, 255, 200, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 110, 255, 255, 255, 28, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 245, 255, 255, 57, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 242, 255, 255, 39, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 93, 255, 255, 218, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 17, 59, 147, 252, 255, 247, 66, 0, 0, 0, 0, 0, 136, 255, 255,
+    255, 255, 255, 255, 255, 206, 48, 0, 0, 0, 0, 0, 0, 136, 255, 255,
+    255, 255, 255, 255, 169, 34, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255,
+    255, 255, 255, 255, 255, 253, 143, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 24, 73, 169, 254, 255, 255, 158, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 84, 254, 255, 255, 64, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 165, 255, 255, 154, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 99, 255, 255, 194, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 104, 255, 255, 191, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 177, 255, 255, 161, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 104, 255, 255, 255, 89, 133, 184, 117, 62, 40, 20, 4,
+    10, 37, 92, 188, 255, 255, 255, 216, 6, 144, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 236, 47, 0, 144, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 187, 36, 0, 0, 9, 64, 124, 181, 210, 231, 250,
+    245, 229, 190, 136, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 29, 242, 255, 255, 255, 60, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 181, 255, 255, 255, 255, 60, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 92, 255, 254, 250, 255, 255, 60, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 236, 255, 150, 232, 255, 255, 60, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 169, 255, 226, 13, 232, 255, 255, 60,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 255, 255, 74, 0, 232, 255,
+    255, 60, 0, 0, 0, 0, 0, 0, 0, 0, 16, 229, 255, 163, 0, 0,
+    232, 255, 255, 60, 0, 0, 0, 0, 0, 0, 0, 0, 157, 255, 233, 19,
+    0, 0, 232, 255, 255, 60, 0, 0, 0, 0, 0, 0, 0, 67, 255, 255,
+    87, 0, 0, 0, 232, 255, 255, 60, 0, 0, 0, 0, 0, 0, 11, 222,
+    255, 177, 0, 0, 0, 0, 232, 255, 255, 60, 0, 0, 0, 0, 0, 0,
+    144, 255, 240, 26, 0, 0, 0, 0, 232, 255, 255, 60, 0, 0, 0, 0,
+    0, 56, 253, 255, 101, 0, 0, 0, 0, 0, 232, 255, 255, 60, 0, 0,
+    0, 0, 6, 213, 255, 190, 1, 0, 0, 0, 0, 0, 232, 255, 255, 60,
+    0, 0, 0, 0, 132, 255, 245, 35, 0, 0, 0, 0, 0, 0, 232, 255,
+    255, 60, 0, 0, 0, 46, 250, 255, 115, 0, 0, 0, 0, 0, 0, 0,
+    232, 255, 255, 60, 0, 0, 0, 112, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 144, 112, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 144, 112, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 144, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 255, 60, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 255, 60, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255, 255, 60,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232, 255,
+    255, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    232, 255, 255, 60, 0, 0, 0, 0, 140, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 216, 0, 0, 0, 140, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 216, 0, 0, 0, 140, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 216, 0, 0, 0, 140, 255, 255, 88, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 140, 255, 255, 88, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 140, 255, 255, 88, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 140, 255, 255, 88, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 140, 255, 255, 88, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 140, 255, 255, 182, 201, 240, 248, 230,
+    189, 126, 28, 0, 0, 0, 0, 0, 140, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 251, 134, 5, 0, 0, 0, 140, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 177, 3, 0, 0, 126, 164, 96, 52, 27, 5, 15, 54,
+    130, 238, 255, 255, 255, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 23, 206, 255, 255, 243, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32, 249, 255, 255, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 186, 255, 255, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 159, 255, 255, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 186, 255, 255, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 31, 249, 255, 255, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 21, 203, 255, 255, 245, 12, 126, 187, 121, 64, 41, 21, 4, 14, 52,
+    127, 236, 255, 255, 255, 127, 0, 136, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 179, 5, 0, 136, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 249, 131, 6, 0, 0, 8, 63, 124, 182, 211, 233, 251, 242, 224,
+    178, 115, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 101, 180, 222,
+    245, 239, 212, 174, 100, 25, 0, 0, 0, 0, 0, 0, 91, 231, 255, 255,
+    255, 255, 255, 255, 255, 255, 212, 0, 0, 0, 0, 0, 125, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 212, 0, 0, 0, 0, 100, 255, 255, 255,
+    243, 130, 47, 13, 6, 29, 77, 153, 185, 0, 0, 0, 30, 242, 255, 255,
+    224, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 255, 255,
+    251, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 241, 255,
+    255, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 255,
+    255, 255, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125,
+    255, 255, 229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    162, 255, 255, 177, 0, 21, 129, 212, 245, 241, 215, 158, 63, 0, 0, 0,
+    0, 179, 255, 255, 137, 58, 231, 255, 255, 255, 255, 255, 255, 255, 177, 17,
+    0, 0, 192, 255, 255, 147, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    201, 10, 0, 183, 255, 255, 251, 255, 213, 89, 25, 4, 20, 79, 199, 255,
+    255, 255, 129, 0, 170, 255, 255, 255, 199, 9, 0, 0, 0, 0, 0, 3,
+    177, 255, 255, 237, 3, 145, 255, 255, 255, 58, 0, 0, 0, 0, 0, 0,
+    0, 29, 254, 255, 255, 49, 101, 255, 255, 252, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 223, 255, 255, 77, 50, 255, 255, 252, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 224, 255, 255, 76, 0, 223, 255, 255, 58, 0, 0, 0,
+    0, 0, 0, 0, 29, 254, 255, 255, 47, 0, 127, 255, 255, 199, 9, 0,
+    0, 0, 0, 0, 3, 177, 255, 255, 232, 1, 0, 12, 230, 255, 255, 212,
+    88, 24, 4, 19, 78, 199, 255, 255, 255, 116, 0, 0, 0, 64, 248, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 5, 0, 0, 0, 0, 69,
+    228, 255, 255, 255, 255, 255, 255, 255, 255, 157, 10, 0, 0, 0, 0, 0,
+    0, 14, 111, 192, 230, 250, 240, 209, 147, 47, 0, 0, 0, 0, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 160, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 137, 96, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 255, 255, 198, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 198, 255, 255, 98, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 43, 255, 255, 242, 11, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 146, 255, 255, 154, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 238, 255, 255, 54, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 94, 255, 255, 210, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 196, 255, 255, 110, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 41, 255, 255, 248, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 144, 255, 255, 166, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 237, 255, 255, 66, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 92, 255, 255, 220, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 194, 255, 255, 122, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 39, 255, 255, 252, 26, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 142, 255, 255, 178, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 236, 255, 255, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 90, 255, 255, 230, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 192, 255, 255, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 38, 255, 255, 254, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 140, 255, 255, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 234, 255, 255, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16, 107, 181, 226, 245, 250, 235, 198, 138, 43, 0, 0, 0, 0, 0,
+    0, 82, 235, 255, 255, 255, 255, 255, 255, 255, 255, 253, 147, 4, 0, 0,
+    0, 75, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 0,
+    0, 0, 221, 255, 255, 249, 147, 52, 19, 10, 37, 110, 225, 255, 255, 255,
+    53, 0, 42, 255, 255, 255, 84, 0, 0, 0, 0, 0, 0, 21, 230, 255,
+    255, 129, 0, 66, 255, 255, 236, 0, 0, 0, 0, 0, 0, 0, 0, 145,
+    255, 255, 153, 0, 44, 255, 255, 235, 0, 0, 0, 0, 0, 0, 0, 0,
+    146, 255, 255, 131, 0, 1, 220, 255, 255, 82, 0, 0, 0, 0, 0, 0,
+    19, 230, 255, 255, 52, 0, 0, 69, 248, 255, 248, 143, 50, 18, 9, 36,
+    107, 223, 255, 255, 145, 0, 0, 0, 0, 51, 209, 255, 255, 255, 255, 255,
+    255, 255, 255, 237, 109, 0, 0, 0, 0, 0, 0, 19, 158, 255, 255, 255,
+    255, 255, 255, 219, 70, 0, 0, 0, 0, 0, 0, 117, 249, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 192, 28, 0, 0, 0, 146, 255, 255, 249, 139,
+    50, 11, 6, 32, 101, 223, 255, 255, 221, 16, 0, 60, 255, 255, 251, 62,
+    0, 0, 0, 0, 0, 0, 15, 209, 255, 255, 147, 0, 155, 255, 255, 159,
+    0, 0, 0, 0, 0, 0, 0, 0, 69, 255, 255, 240, 2, 200, 255, 255,
+    99, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255, 255, 255, 31, 204, 255,
+    255, 99, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255, 255, 255, 35, 181,
+    255, 255, 159, 0, 0, 0, 0, 0, 0, 0, 0, 70, 255, 255, 254, 12,
+    121, 255, 255, 251, 62, 0, 0, 0, 0, 0, 0, 15, 210, 255, 255, 207,
+    0, 28, 247, 255, 255, 249, 139, 49, 10, 5, 32, 101, 223, 255, 255, 255,
+    105, 0, 0, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    189, 4, 0, 0, 0, 103, 244, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    163, 12, 0, 0, 0, 0, 0, 20, 115, 183, 228, 246, 250, 235, 201, 143,
+    48, 0, 0, 0, 0, 0, 0, 0, 16, 115, 186, 231, 249, 237, 210, 139,
+    43, 0, 0, 0, 0, 0, 0, 0, 86, 240, 255, 255, 255, 255, 255, 255,
+    255, 251, 130, 1, 0, 0, 0, 0, 96, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 140, 0, 0, 0, 30, 247, 255, 255, 236, 112, 35, 6,
+    13, 60, 167, 255, 255, 255, 71, 0, 0, 141, 255, 255, 235, 34, 0, 0,
+    0, 0, 0, 0, 121, 255, 255, 211, 0, 0, 211, 255, 255, 119, 0, 0,
+    0, 0, 0, 0, 0, 2, 222, 255, 255, 54, 0, 241, 255, 255, 59, 0,
+    0, 0, 0, 0, 0, 0, 0, 163, 255, 255, 137, 0, 242, 255, 255, 58,
+    0, 0, 0, 0, 0, 0, 0, 0, 164, 255, 255, 188, 0, 216, 255, 255,
+    117, 0, 0, 0, 0, 0, 0, 0, 2, 221, 255, 255, 232, 0, 152, 255,
+    255, 234, 31, 0, 0, 0, 0, 0, 0, 117, 255, 255, 255, 254, 2, 46,
+    253, 255, 255, 235, 110, 33, 5, 12, 58, 163, 255, 251, 255, 255, 255, 14,
+    0, 130, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 134, 255, 255, 255,
+    24, 0, 0, 121, 251, 255, 255, 255, 255, 255, 255, 254, 129, 50, 255, 255,
+    255, 10, 0, 0, 0, 31, 134, 200, 237, 250, 226, 169, 58, 0, 90, 255,
+    255, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142,
+    255, 255, 212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    219, 255, 255, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    63, 255, 255, 255, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 203, 255, 255, 229, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 163, 255, 255, 255, 105, 0, 0, 0, 114, 177, 97, 48, 21, 6, 30,
+    97, 212, 255, 255, 255, 187, 1, 0, 0, 0, 124, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 198, 15, 0, 0, 0, 0, 124, 255, 255, 255, 255,
+    255, 255, 255, 255, 252, 149, 12, 0, 0, 0, 0, 0, 9, 75, 151, 204,
+    231, 249, 231, 201, 130, 41, 0, 0, 0, 0, 0, 0, 64, 255, 255, 255,
+    12, 64, 255, 255, 255, 12, 64, 255, 255, 255, 12, 64, 255, 255, 255, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 255, 255,
+    255, 12, 64, 255, 255, 255, 12, 64, 255, 255, 255, 12, 64, 255, 255, 255,
+    12, 0, 64, 255, 255, 255, 12, 0, 64, 255, 255, 255, 12, 0, 64, 255,
+    255, 255, 12, 0, 64, 255, 255, 255, 12, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    64, 255, 255, 255, 12, 0, 64, 255, 255, 255, 12, 0, 65, 255, 255, 255,
+    10, 0, 108, 255, 255, 179, 0, 0, 171, 255, 255, 53, 0, 0, 233, 255,
+    183, 0, 0, 41, 255, 255, 57, 0, 0, 104, 255, 187, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 78, 170, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 57, 150, 236, 255, 255, 108, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 37, 129, 220, 255, 255, 255, 255, 255, 97, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 21, 108, 200, 255, 255, 255, 255, 255, 219,
+    130, 39, 0, 0, 0, 0, 0, 0, 0, 9, 87, 180, 251, 255, 255, 255,
+    255, 231, 145, 54, 0, 0, 0, 0, 0, 0, 0, 2, 66, 159, 242, 255,
+    255, 255, 255, 241, 160, 69, 3, 0, 0, 0, 0, 0, 0, 0, 46, 138,
+    228, 255, 255, 255, 255, 248, 175, 84, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 139, 255, 255, 255, 255, 253, 189, 99, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 156, 255, 255, 255, 211, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 255, 255, 255,
+    255, 251, 182, 92, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 47, 139, 228, 255, 255, 255, 255, 245, 168, 78, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 67, 160, 242, 255, 255, 255,
+    255, 238, 155, 65, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 88, 181, 251, 255, 255, 255, 255, 228, 141, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 109, 201, 255, 255, 255, 255,
+    255, 217, 128, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 38, 130, 221, 255, 255, 255, 255, 255, 97, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 151, 236, 255, 255, 108, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 79, 171, 99, 156, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 108, 156, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108, 156, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 156, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108, 156, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    108, 156, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 108, 138, 153, 61, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 255, 255, 223, 132,
+    40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    145, 255, 255, 255, 255, 255, 204, 111, 23, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 57, 147, 233, 255, 255, 255, 255, 252, 183, 91,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 72, 163,
+    243, 255, 255, 255, 255, 243, 162, 70, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 87, 178, 250, 255, 255, 255, 255, 230, 141, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 103, 193,
+    254, 255, 255, 255, 255, 213, 121, 30, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 29, 118, 209, 255, 255, 255, 255, 254, 92, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 234, 255,
+    255, 255, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+    111, 201, 255, 255, 255, 255, 254, 92, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 15, 97, 187, 252, 255, 255, 255, 255, 213, 122, 30, 0, 0, 0, 0,
+    0, 0, 0, 8, 83, 173, 248, 255, 255, 255, 255, 231, 142, 50, 0, 0,
+    0, 0, 0, 0, 0, 3, 69, 159, 241, 255, 255, 255, 255, 243, 163, 71,
+    3, 0, 0, 0, 0, 0, 0, 0, 55, 145, 232, 255, 255, 255, 255, 252,
+    184, 92, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 255, 255, 255,
+    255, 255, 205, 112, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 156, 255, 255, 224, 133, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 138, 154, 62, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 140, 203,
+    237, 250, 234, 186, 99, 6, 0, 0, 37, 182, 255, 255, 255, 255, 255, 255,
+    255, 255, 206, 28, 0, 180, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    211, 5, 180, 255, 210, 111, 42, 9, 23, 76, 205, 255, 255, 255, 96, 143,
+    78, 0, 0, 0, 0, 0, 0, 8, 211, 255, 255, 165, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 122, 255, 255, 185, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 135, 255, 255, 156, 0, 0, 0, 0, 0, 0, 0, 0, 18, 231,
+    255, 255, 70, 0, 0, 0, 0, 0, 0, 0, 14, 197, 255, 255, 172, 0,
+    0, 0, 0, 0, 0, 0, 20, 204, 255, 255, 200, 12, 0, 0, 0, 0,
+    0, 0, 21, 212, 255, 255, 197, 17, 0, 0, 0, 0, 0, 0, 4, 203,
+    255, 255, 183, 9, 0, 0, 0, 0, 0, 0, 0, 102, 255, 255, 204, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 174, 255, 255, 86, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 198, 255, 255, 52, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 204, 255, 255, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204,
+    255, 255, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 228, 255, 255, 72, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 228, 255, 255, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    228, 255, 255, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 255, 255,
+    72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    120, 180, 221, 244, 252, 241, 216, 173, 108, 28, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 191, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 252, 174, 43, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 180, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 252, 134, 5, 0, 0, 0, 0, 0, 0, 0, 0, 50, 225,
+    255, 255, 255, 233, 150, 88, 39, 16, 5, 25, 48, 92, 170, 241, 255, 255,
+    255, 187, 12, 0, 0, 0, 0, 0, 0, 48, 244, 255, 255, 223, 96, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 128, 244, 255, 255, 191, 6,
+    0, 0, 0, 0, 23, 225, 255, 255, 153, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 27, 208, 255, 255, 145, 0, 0, 0, 0,
+    179, 255, 255, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 14, 192, 255, 253, 57, 0, 0, 60, 255, 255, 147, 0,
+    0, 0, 0, 0, 52, 168, 230, 248, 221, 147, 29, 0, 148, 255, 168, 0,
+    0, 17, 225, 255, 183, 0, 0, 193, 255, 216, 8, 0, 0, 0, 0, 110,
+    253, 255, 255, 255, 255, 255, 235, 56, 148, 255, 168, 0, 0, 0, 88, 255,
+    254, 34, 37, 255, 255, 85, 0, 0, 0, 0, 75, 255, 255, 255, 255, 255,
+    255, 255, 255, 231, 170, 255, 168, 0, 0, 0, 2, 233, 255, 104, 113, 255,
+    232, 3, 0, 0, 0, 2, 219, 255, 255, 184, 61, 11, 9, 56, 173, 255,
+    255, 255, 168, 0, 0, 0, 0, 167, 255, 159, 169, 255, 158, 0, 0, 0,
+    0, 62, 255, 255, 173, 1, 0, 0, 0, 0, 0, 154, 255, 255, 168, 0,
+    0, 0, 0, 137, 255, 181, 205, 255, 109, 0, 0, 0, 0, 118, 255, 255,
+    39, 0, 0, 0, 0, 0, 0, 20, 252, 255, 168, 0, 0, 0, 0, 132,
+    255, 187, 222, 255, 87, 0, 0, 0, 0, 143, 255, 242, 0, 0, 0, 0,
+    0, 0, 0, 0, 218, 255, 168, 0, 0, 0, 0, 160, 255, 167, 223, 255,
+    92, 0, 0, 0, 0, 143, 255, 241, 0, 0, 0, 0, 0, 0, 0, 0,
+    218, 255, 168, 0, 0, 0, 2, 225, 255, 125, 207, 255, 117, 0, 0, 0,
+    0, 120, 255, 255, 38, 0, 0, 0, 0, 0, 0, 18, 252, 255, 168, 0,
+    0, 0, 95, 255, 255, 54, 173, 255, 159, 0, 0, 0, 0, 64, 255, 255,
+    170, 0, 0, 0, 0, 0, 0, 148, 255, 255, 168, 0, 0, 56, 241, 255,
+    196, 0, 121, 255, 235, 3, 0, 0, 0, 3, 223, 255, 255, 181, 60, 10,
+    8, 51, 166, 255, 255, 255, 171, 48, 143, 250, 255, 247, 51, 0, 50, 255,
+    255, 79, 0, 0, 0, 0, 82, 255, 255, 255, 255, 255, 255, 255, 255, 231,
+    169, 255, 255, 255, 255, 255, 247, 82, 0, 0, 0, 210, 255, 217, 5, 0,
+    0, 0, 0, 116, 254, 255, 255, 255, 255, 255, 235, 56, 148, 255, 255, 255,
+    255, 201, 47, 0, 0, 0, 0, 80, 255, 255, 140, 0, 0, 0, 0, 0,
+    56, 171, 232, 249, 222, 149, 30, 0, 144, 231, 202, 142, 64, 0, 0, 0,
+    0, 0, 0, 0, 198, 255, 255, 114, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 237, 255, 255, 148, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32, 190, 36, 0, 0, 0, 0, 0, 0, 0, 0, 64, 250, 255,
+    255, 211, 83, 2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 112, 239, 255,
+    200, 4, 0, 0, 0, 0, 0, 0, 0, 0, 68, 236, 255, 255, 255, 219,
+    142, 74, 36, 15, 7, 31, 71, 145, 230, 255, 255, 255, 141, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 32, 201, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 244, 98, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 84, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    253, 160, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 61, 136, 192, 229, 248, 251, 233, 190, 123, 33, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 248,
+    255, 255, 232, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 109, 255, 255, 255, 255, 79, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 255, 255, 178,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51,
+    255, 255, 186, 217, 255, 252, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 150, 255, 255, 86, 118, 255, 255, 120, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 240, 255, 236, 6, 23,
+    251, 255, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    92, 255, 255, 143, 0, 0, 175, 255, 255, 62, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 192, 255, 255, 44, 0, 0, 76, 255, 255, 161,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 254, 255, 201, 0,
+    0, 0, 3, 228, 255, 245, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 134, 255, 255, 102, 0, 0, 0, 0, 132, 255, 255, 103, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 229, 255, 245, 13, 0, 0, 0, 0, 34,
+    254, 255, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 255, 255, 159,
+    0, 0, 0, 0, 0, 0, 189, 255, 255, 45, 0, 0, 0, 0, 0, 0,
+    0, 0, 175, 255, 255, 60, 0, 0, 0, 0, 0, 0, 90, 255, 255, 144,
+    0, 0, 0, 0, 0, 0, 0, 23, 251, 255, 216, 0, 0, 0, 0, 0,
+    0, 0, 7, 237, 255, 236, 6, 0, 0, 0, 0, 0, 0, 117, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 86, 0, 0, 0,
+    0, 0, 0, 216, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 185, 0, 0, 0, 0, 0, 60, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 253, 30, 0, 0, 0, 0, 159, 255,
+    255, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 255, 255, 127,
+    0, 0, 0, 13, 244, 255, 255, 43, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 64, 255, 255, 224, 2, 0, 0, 101, 255, 255, 208, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 227, 255, 255, 69, 0, 0, 200,
+    255, 255, 118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139,
+    255, 255, 168, 0, 43, 255, 255, 254, 29, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 48, 255, 255, 248, 18, 142, 255, 255, 193, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 213, 255, 255, 110,
+    220, 255, 255, 255, 255, 255, 255, 255, 251, 238, 205, 151, 62, 0, 0, 0,
+    0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 180, 15,
+    0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    196, 2, 0, 220, 255, 255, 76, 0, 0, 0, 0, 6, 29, 89, 209, 255,
+    255, 255, 84, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 10,
+    218, 255, 255, 155, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 132, 255, 255, 176, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0,
+    0, 0, 132, 255, 255, 149, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 9, 217, 255, 255, 95, 0, 220, 255, 255, 76, 0, 0, 0, 0,
+    5, 28, 86, 207, 255, 255, 215, 4, 0, 220, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 254, 183, 22, 0, 0, 220, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 252, 146, 25, 0, 0, 0, 220, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 248, 109, 0, 0, 220, 255, 255, 76,
+    0, 0, 0, 0, 2, 18, 63, 157, 253, 255, 255, 106, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 104, 255, 255, 246, 21, 220, 255,
+    255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 1, 223, 255, 255, 108, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174, 255, 255, 157,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 175, 255, 255,
+    170, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 1, 224, 255,
+    255, 150, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 107, 255,
+    255, 255, 94, 220, 255, 255, 76, 0, 0, 0, 0, 2, 17, 63, 158, 254,
+    255, 255, 234, 15, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 252, 81, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 230, 76, 0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 254, 242,
+    219, 171, 96, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 128,
+    191, 222, 242, 250, 235, 208, 159, 94, 14, 0, 0, 0, 0, 0, 0, 0,
+    60, 193, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 147, 24, 0,
+    0, 0, 0, 115, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 156, 0, 0, 0, 125, 255, 255, 255, 255, 183, 99, 40, 16, 4,
+    19, 42, 92, 156, 239, 255, 156, 0, 0, 72, 253, 255, 255, 228, 58, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 106, 131, 0, 2, 215, 255, 255,
+    232, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    83, 255, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 164, 255, 255, 209, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 229, 255, 255, 129, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 255, 255, 255, 73,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33,
+    255, 255, 255, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 47, 255, 255, 255, 36, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 33, 255, 255, 255, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 255, 255, 255, 73,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    229, 255, 255, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 164, 255, 255, 209, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 83, 255, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 215, 255, 255,
+    232, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 73, 254, 255, 255, 227, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 105, 130, 0, 0, 0, 125, 255, 255, 255, 255, 183, 98, 40, 15, 4,
+    18, 41, 91, 155, 239, 255, 156, 0, 0, 0, 0, 116, 252, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 156, 0, 0, 0, 0, 0,
+    61, 194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 146, 24, 0,
+    0, 0, 0, 0, 0, 0, 56, 129, 192, 223, 243, 250, 236, 208, 158, 91,
+    12, 0, 0, 220, 255, 255, 255, 255, 255, 254, 243, 229, 214, 175, 126, 71,
+    4, 0, 0, 0, 0, 0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 231, 134, 14, 0, 0, 0, 0, 220, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226, 66, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 6, 21, 42, 91, 154, 242, 255, 255, 255, 248,
+    60, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+    148, 255, 255, 255, 236, 19, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 114, 255, 255, 255, 135, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 182, 255, 255, 243, 7, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255,
+    255, 255, 62, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 239, 255, 255, 124, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 187, 255, 255, 155, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 255, 255, 173, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152,
+    255, 255, 187, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 166, 255, 255, 173, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 187, 255, 255, 154, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 240, 255, 255, 123, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 255,
+    255, 255, 60, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 183, 255, 255, 242, 6, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 115, 255, 255, 255, 133, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 12, 147, 255, 255, 255, 235, 18, 0, 220,
+    255, 255, 76, 0, 0, 0, 5, 19, 41, 90, 154, 242, 255, 255, 255, 247,
+    57, 0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 224, 64, 0, 0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 230, 134, 13, 0, 0, 0, 0, 220, 255, 255, 255, 255,
+    255, 255, 244, 230, 215, 176, 127, 70, 3, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 104, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 44, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 44, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 44, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 220, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 220, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 140, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 0, 220, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 140, 0, 220, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 140, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 47, 120, 183, 218, 237, 251, 239, 223,
+    183, 135, 64, 3, 0, 0, 0, 0, 0, 0, 0, 0, 55, 186, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 129, 19, 0, 0, 0, 0,
+    0, 113, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 144, 0, 0, 0, 0, 126, 255, 255, 255, 255, 190, 105, 48, 21, 5,
+    12, 27, 64, 112, 183, 250, 255, 144, 0, 0, 0, 74, 254, 255, 255, 226,
+    59, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 125, 124, 0, 0,
+    2, 216, 255, 255, 229, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 86, 255, 255, 255, 70, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 255, 255, 205,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 229, 255, 255, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 255, 255, 255, 71, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 255, 255,
+    255, 48, 0, 0, 0, 0, 0, 0, 0, 28, 255, 255, 255, 255, 255, 255,
+    255, 255, 44, 47, 255, 255, 255, 36, 0, 0, 0, 0, 0, 0, 0, 28,
+    255, 255, 255, 255, 255, 255, 255, 255, 44, 33, 255, 255, 255, 48, 0, 0,
+    0, 0, 0, 0, 0, 28, 255, 255, 255, 255, 255, 255, 255, 255, 44, 14,
+    255, 255, 255, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 244, 255, 255, 44, 0, 230, 255, 255, 127, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 244, 255, 255, 44, 0, 165, 255, 255, 205,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 244, 255, 255,
+    44, 0, 86, 255, 255, 255, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 244, 255, 255, 44, 0, 3, 218, 255, 255, 228, 24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 244, 255, 255, 44, 0, 0, 77,
+    254, 255, 255, 225, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 245,
+    255, 255, 44, 0, 0, 0, 128, 255, 255, 255, 255, 189, 104, 47, 19, 4,
+    8, 25, 62, 126, 219, 255, 255, 255, 43, 0, 0, 0, 0, 118, 252, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 110, 1, 0,
+    0, 0, 0, 0, 58, 189, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    249, 160, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 122, 185, 220,
+    239, 251, 235, 214, 166, 102, 24, 0, 0, 0, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255,
+    236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60,
+    255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    236, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255, 236, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 255, 255,
+    236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60,
+    255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 60, 255, 255, 236, 220, 255, 255, 76, 220, 255, 255,
+    76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255,
+    76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255,
+    76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255,
+    76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255,
+    76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255, 76, 220, 255, 255,
+    76, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255,
+    255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255, 255, 76,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 220, 255,
+    255, 75, 0, 0, 0, 0, 0, 227, 255, 255, 66, 0, 0, 0, 0, 0,
+    245, 255, 255, 53, 0, 0, 0, 0, 36, 255, 255, 255, 19, 0, 0, 0,
+    0, 132, 255, 255, 225, 0, 0, 4, 33, 127, 253, 255, 255, 140, 0, 168,
+    255, 255, 255, 255, 255, 240, 25, 0, 168, 255, 255, 255, 255, 242, 67, 0,
+    0, 168, 254, 238, 204, 133, 23, 0, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 0, 0, 0, 0, 0, 11, 186, 255, 255, 248, 81, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 17, 199, 255, 255, 242, 66, 0, 0,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 25, 211, 255, 255, 235, 52,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 35, 222, 255, 255,
+    227, 41, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 45, 231,
+    255, 255, 217, 30, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0,
+    57, 238, 255, 255, 205, 21, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76,
+    0, 0, 71, 245, 255, 255, 192, 14, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 86, 249, 255, 255, 177, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 220, 255, 255, 76, 102, 253, 255, 255, 161, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 255, 255, 185, 255, 255, 255, 143, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 255, 255, 255, 145, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 255, 255,
+    255, 228, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255,
+    255, 125, 237, 255, 255, 229, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 47, 236, 255, 255, 230, 40, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 220, 255, 255, 76, 0, 46, 235, 255, 255, 231, 41, 0,
+    0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 44, 233, 255,
+    255, 233, 43, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 42, 232, 255, 255, 233, 44, 0, 0, 0, 0, 0, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 41, 231, 255, 255, 235, 46, 0, 0, 0, 0, 0,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 39, 229, 255, 255, 235, 47, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 37, 228, 255,
+    255, 237, 49, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0,
+    0, 36, 227, 255, 255, 238, 50, 0, 0, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 34, 225, 255, 255, 238, 52, 0, 220, 255, 255, 76,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 224, 255, 255, 240, 54, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255,
+    255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220,
+    255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255,
+    255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 76,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 168, 220, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 168, 220, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 168, 220, 255, 255, 255, 247, 15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 104, 255, 255, 255, 255, 124, 220, 255,
+    255, 255, 255, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200, 255,
+    255, 255, 255, 124, 220, 255, 255, 255, 255, 197, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 40, 255, 255, 255, 255, 255, 124, 220, 255, 255, 197, 255, 255,
+    37, 0, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255, 196, 255, 255, 124,
+    220, 255, 255, 101, 255, 255, 132, 0, 0, 0, 0, 0, 0, 0, 2, 228,
+    255, 204, 152, 255, 255, 124, 220, 255, 255, 52, 209, 255, 225, 1, 0, 0,
+    0, 0, 0, 0, 71, 255, 255, 109, 152, 255, 255, 124, 220, 255, 255, 52,
+    114, 255, 255, 66, 0, 0, 0, 0, 0, 0, 167, 255, 249, 19, 152, 255,
+    255, 124, 220, 255, 255, 52, 23, 251, 255, 161, 0, 0, 0, 0, 0, 15,
+    247, 255, 174, 0, 152, 255, 255, 124, 220, 255, 255, 52, 0, 179, 255, 244,
+    12, 0, 0, 0, 0, 102, 255, 255, 78, 0, 152, 255, 255, 124, 220, 255,
+    255, 52, 0, 84, 255, 255, 96, 0, 0, 0, 0, 198, 255, 234, 5, 0,
+    152, 255, 255, 124, 220, 255, 255, 52, 0, 6, 237, 255, 191, 0, 0, 0,
+    38, 255, 255, 143, 0, 0, 152, 255, 255, 124, 220, 255, 255, 52, 0, 0,
+    149, 255, 254, 32, 0, 0, 134, 255, 255, 48, 0, 0, 152, 255, 255, 124,
+    220, 255, 255, 52, 0, 0, 53, 255, 255, 126, 0, 2, 226, 255, 208, 0,
+    0, 0, 152, 255, 255, 124, 220, 255, 255, 52, 0, 0, 0, 213, 255, 220,
+    0, 69, 255, 255, 113, 0, 0, 0, 152, 255, 255, 124, 220, 255, 255, 52,
+    0, 0, 0, 118, 255, 255, 60, 165, 255, 251, 22, 0, 0, 0, 152, 255,
+    255, 124, 220, 255, 255, 52, 0, 0, 0, 26, 252, 255, 170, 246, 255, 178,
+    0, 0, 0, 0, 152, 255, 255, 124, 220, 255, 255, 52, 0, 0, 0, 0,
+    183, 255, 255, 255, 255, 82, 0, 0, 0, 0, 152, 255, 255, 124, 220, 255,
+    255, 52, 0, 0, 0, 0, 88, 255, 255, 255, 236, 6, 0, 0, 0, 0,
+    152, 255, 255, 124, 220, 255, 255, 52, 0, 0, 0, 0, 8, 239, 255, 255,
+    147, 0, 0, 0, 0, 0, 152, 255, 255, 124, 220, 255, 255, 52, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255, 124,
+    220, 255, 255, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 152, 255, 255, 124, 220, 255, 255, 52, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255, 124, 220, 255, 255, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255,
+    255, 124, 220, 255, 255, 255, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    68, 255, 255, 204, 220, 255, 255, 255, 254, 51, 0, 0, 0, 0, 0, 0,
+    0, 0, 68, 255, 255, 204, 220, 255, 255, 255, 255, 187, 0, 0, 0, 0,
+    0, 0, 0, 0, 68, 255, 255, 204, 220, 255, 255, 252, 255, 255, 69, 0,
+    0, 0, 0, 0, 0, 0, 68, 255, 255, 204, 220, 255, 255, 155, 255, 255,
+    205, 1, 0, 0, 0, 0, 0, 0, 68, 255, 255, 204, 220, 255, 255, 56,
+    217, 255, 255, 89, 0, 0, 0, 0, 0, 0, 68, 255, 255, 204, 220, 255,
+    255, 52, 84, 255, 255, 220, 5, 0, 0, 0, 0, 0, 68, 255, 255, 204,
+    220, 255, 255, 52, 0, 201, 255, 255, 108, 0, 0, 0, 0, 0, 68, 255,
+    255, 204, 220, 255, 255, 52, 0, 64, 255, 255, 233, 12, 0, 0, 0, 0,
+    68, 255, 255, 204, 220, 255, 255, 52, 0, 0, 183, 255, 255, 127, 0, 0,
+    0, 0, 68, 255, 255, 204, 220, 255, 255, 52, 0, 0, 47, 254, 255, 242,
+    22, 0, 0, 0, 68, 255, 255, 204, 220, 255, 255, 52, 0, 0, 0, 164,
+    255, 255, 147, 0, 0, 0, 68, 255, 255, 204, 220, 255, 255, 52, 0, 0,
+    0, 32, 249, 255, 250, 34, 0, 0, 68, 255, 255, 204, 220, 255, 255, 52,
+    0, 0, 0, 0, 144, 255, 255, 166, 0, 0, 68, 255, 255, 204, 220, 255,
+    255, 52, 0, 0, 0, 0, 20, 241, 255, 254, 49, 0, 68, 255, 255, 204,
+    220, 255, 255, 52, 0, 0, 0, 0, 0, 125, 255, 255, 185, 0, 68, 255,
+    255, 204, 220, 255, 255, 52, 0, 0, 0, 0, 0, 11, 231, 255, 255, 67,
+    68, 255, 255, 204, 220, 255, 255, 52, 0, 0, 0, 0, 0, 0, 106, 255,
+    255, 203, 69, 255, 255, 204, 220, 255, 255, 52, 0, 0, 0, 0, 0, 0,
+    4, 218, 255, 255, 154, 255, 255, 204, 220, 255, 255, 52, 0, 0, 0, 0,
+    0, 0, 0, 86, 255, 255, 252, 255, 255, 204, 220, 255, 255, 52, 0, 0,
+    0, 0, 0, 0, 0, 1, 203, 255, 255, 255, 255, 204, 220, 255, 255, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 66, 255, 255, 255, 255, 204, 220, 255,
+    255, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 185, 255, 255, 255, 204,
+    0, 0, 0, 0, 0, 0, 3, 77, 150, 208, 231, 249, 236, 215, 165, 93,
+    12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 216, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 234, 110, 2, 0, 0, 0, 0, 0, 0,
+    0, 1, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    174, 10, 0, 0, 0, 0, 0, 0, 140, 255, 255, 255, 251, 157, 73, 25,
+    6, 20, 58, 135, 241, 255, 255, 255, 185, 2, 0, 0, 0, 0, 78, 255,
+    255, 255, 221, 43, 0, 0, 0, 0, 0, 0, 0, 21, 192, 255, 255, 255,
+    125, 0, 0, 0, 2, 219, 255, 255, 231, 24, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 200, 255, 255, 247, 22, 0, 0, 85, 255, 255, 255, 78,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 251, 255, 255, 132,
+    0, 0, 166, 255, 255, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 166, 255, 255, 213, 0, 0, 229, 255, 255, 130, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 255, 255, 255, 21, 14,
+    255, 255, 255, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 255, 255, 255, 61, 33, 255, 255, 255, 48, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 254, 255, 255, 80, 47, 255, 255,
+    255, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    244, 255, 255, 95, 33, 255, 255, 255, 48, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 254, 255, 255, 80, 14, 255, 255, 255, 74,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 255, 255,
+    255, 61, 0, 229, 255, 255, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 83, 255, 255, 255, 21, 0, 166, 255, 255, 212, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 255, 255, 213, 0,
+    0, 86, 255, 255, 255, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 250, 255, 255, 132, 0, 0, 3, 221, 255, 255, 231, 24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 200, 255, 255, 247, 22, 0, 0, 0,
+    81, 255, 255, 255, 220, 42, 0, 0, 0, 0, 0, 0, 0, 21, 191, 255,
+    255, 255, 125, 0, 0, 0, 0, 0, 143, 255, 255, 255, 251, 156, 71, 24,
+    5, 19, 56, 134, 241, 255, 255, 255, 185, 2, 0, 0, 0, 0, 0, 2,
+    140, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 83, 217, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 234, 110, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 79, 152, 210, 233, 250, 237, 215, 166, 94, 12, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 255, 255, 255, 255, 251, 236, 205, 150, 58, 0, 0, 0,
+    0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 177, 18, 0,
+    0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 7,
+    0, 220, 255, 255, 76, 0, 0, 0, 4, 29, 98, 224, 255, 255, 255, 114,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 19, 221, 255, 255, 214,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 97, 255, 255, 255,
+    18, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 43, 255, 255, 255,
+    41, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 43, 255, 255, 255,
+    41, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 97, 255, 255, 255,
+    18, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 17, 220, 255, 255, 214,
+    0, 220, 255, 255, 76, 0, 0, 0, 4, 28, 96, 221, 255, 255, 255, 115,
+    0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 202, 8,
+    0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 181, 20, 0,
+    0, 220, 255, 255, 255, 255, 255, 255, 251, 237, 207, 152, 61, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 77, 150, 208, 231, 249, 236, 215, 165,
+    94, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 216, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 235, 113, 2, 0, 0, 0, 0, 0,
+    0, 0, 1, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 179, 12, 0, 0, 0, 0, 0, 0, 140, 255, 255, 255, 251, 157, 73,
+    25, 6, 20, 58, 135, 241, 255, 255, 255, 191, 3, 0, 0, 0, 0, 78,
+    255, 255, 255, 221, 43, 0, 0, 0, 0, 0, 0, 0, 21, 192, 255, 255,
+    255, 133, 0, 0, 0, 2, 219, 255, 255, 231, 24, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8, 200, 255, 255, 249, 27, 0, 0, 85, 255, 255, 255,
+    78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 251, 255, 255,
+    139, 0, 0, 166, 255, 255, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 166, 255, 255, 217, 0, 0, 229, 255, 255, 130, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 255, 255, 255, 25,
+    14, 255, 255, 255, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 27, 255, 255, 255, 63, 33, 255, 255, 255, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 254, 255, 255, 82, 47, 255,
+    255, 255, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 244, 255, 255, 95, 33, 255, 255, 255, 48, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 254, 255, 255, 83, 14, 255, 255, 255,
+    74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 255,
+    255, 255, 60, 0, 229, 255, 255, 130, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 83, 255, 255, 255, 16, 0, 166, 255, 255, 212, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 255, 255, 205,
+    0, 0, 85, 255, 255, 255, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 36, 250, 255, 255, 116, 0, 0, 3, 219, 255, 255, 231, 24, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 7, 200, 255, 255, 236, 13, 0, 0,
+    0, 78, 255, 255, 255, 220, 42, 0, 0, 0, 0, 0, 0, 0, 21, 191,
+    255, 255, 255, 92, 0, 0, 0, 0, 0, 140, 255, 255, 255, 251, 156, 71,
+    24, 5, 19, 56, 134, 241, 255, 255, 255, 144, 0, 0, 0, 0, 0, 0,
+    1, 136, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 126,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 216, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 187, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 78, 151, 209, 232, 252, 255, 255, 255, 255, 120, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165,
+    255, 255, 253, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 194, 255, 255, 242, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 217,
+    255, 255, 222, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 35, 235, 255, 255, 192, 5, 0, 0, 220, 255,
+    255, 255, 255, 255, 255, 251, 238, 212, 164, 84, 5, 0, 0, 0, 0, 0,
+    0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 214, 49, 0,
+    0, 0, 0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 237, 32, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 3, 23,
+    78, 194, 255, 255, 255, 164, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 0, 0, 0, 3, 184, 255, 255, 242, 5, 0, 0, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 67, 255, 255, 255, 32, 0, 0, 0,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 38, 255, 255, 255, 46,
+    0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 69, 255,
+    255, 255, 25, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0,
+    4, 187, 255, 255, 217, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0,
+    3, 23, 79, 196, 255, 255, 255, 95, 0, 0, 0, 0, 220, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 120, 0, 0, 0, 0, 0, 220,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 183, 48, 0, 0, 0, 0,
+    0, 0, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 97, 0,
+    0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 1, 23, 68, 183, 255,
+    255, 254, 78, 0, 0, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0,
+    0, 0, 150, 255, 255, 234, 21, 0, 0, 0, 0, 220, 255, 255, 76, 0,
+    0, 0, 0, 0, 0, 6, 214, 255, 255, 144, 0, 0, 0, 0, 220, 255,
+    255, 76, 0, 0, 0, 0, 0, 0, 0, 75, 255, 255, 248, 29, 0, 0,
+    0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 201, 255, 255,
+    150, 0, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0,
+    76, 255, 255, 249, 28, 0, 0, 220, 255, 255, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 205, 255, 255, 147, 0, 0, 220, 255, 255, 76, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 80, 255, 255, 248, 26, 0, 220, 255, 255,
+    76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 208, 255, 255, 145, 0,
+    220, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 255,
+    255, 247, 25, 0, 0, 0, 16, 106, 176, 223, 243, 250, 232, 213, 192, 144,
+    89, 33, 0, 0, 0, 0, 99, 240, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 32, 0, 0, 120, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 32, 0, 47, 252, 255, 255, 239, 132, 55, 17, 4, 18,
+    38, 60, 108, 164, 221, 31, 0, 149, 255, 255, 230, 32, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 204, 255, 255, 113, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 255, 255, 82, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 205, 255, 255, 132, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 255, 255, 248, 79,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 247, 255, 255,
+    255, 220, 148, 95, 43, 2, 0, 0, 0, 0, 0, 0, 0, 0, 80, 245,
+    255, 255, 255, 255, 255, 255, 244, 189, 123, 35, 0, 0, 0, 0, 0, 0,
+    37, 165, 249, 255, 255, 255, 255, 255, 255, 255, 254, 167, 22, 0, 0, 0,
+    0, 0, 0, 16, 89, 149, 202, 246, 255, 255, 255, 255, 255, 227, 31, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 45, 114, 215, 255, 255, 255, 195,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 150, 255, 255,
+    255, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 237,
+    255, 255, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    203, 255, 255, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    5, 236, 255, 255, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 139, 255, 255, 255, 59, 187, 189, 138, 87, 54, 36, 19, 3, 9, 38,
+    94, 196, 255, 255, 255, 211, 1, 204, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 240, 51, 0, 204, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 200, 45, 0, 0, 16, 65, 115, 164, 199, 218, 237,
+    252, 245, 230, 193, 142, 61, 1, 0, 0, 0, 24, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 164, 24,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 164, 24, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 164, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208,
+    255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255,
+    255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255,
+    92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 56, 255, 255,
+    244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255, 164,
+    56, 255, 255, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136,
+    255, 255, 164, 56, 255, 255, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 136, 255, 255, 164, 56, 255, 255, 244, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 136, 255, 255, 164, 56, 255, 255, 244, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255, 164, 56, 255, 255, 244,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255, 164, 56,
+    255, 255, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 255,
+    255, 164, 56, 255, 255, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 136, 255, 255, 164, 56, 255, 255, 244, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 136, 255, 255, 164, 56, 255, 255, 244, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 136, 255, 255, 164, 56, 255, 255, 244, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255, 164, 56, 255,
+    255, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 255, 255,
+    164, 56, 255, 255, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    136, 255, 255, 164, 55, 255, 255, 246, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 138, 255, 255, 163, 43, 255, 255, 255, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 151, 255, 255, 150, 26, 255, 255, 255, 32, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 181, 255, 255, 133, 1, 238, 255,
+    255, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 233, 255, 255, 90,
+    0, 181, 255, 255, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 255,
+    255, 255, 31, 0, 83, 255, 255, 255, 106, 0, 0, 0, 0, 0, 0, 0,
+    30, 224, 255, 255, 189, 0, 0, 3, 206, 255, 255, 255, 172, 73, 22, 4,
+    12, 47, 122, 235, 255, 255, 253, 61, 0, 0, 0, 36, 234, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 0, 0, 0, 0, 0, 31,
+    196, 255, 255, 255, 255, 255, 255, 255, 255, 255, 237, 93, 0, 0, 0, 0,
+    0, 0, 0, 0, 64, 148, 207, 235, 250, 242, 223, 174, 106, 12, 0, 0,
+    0, 0, 143, 255, 255, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 216, 255, 255, 110, 43, 255, 255, 254, 32, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 255, 255, 248, 18, 0, 200,
+    255, 255, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157,
+    255, 255, 168, 0, 0, 101, 255, 255, 224, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 11, 243, 255, 255, 69, 0, 0, 13, 244, 255, 255, 67,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 255, 255, 224, 2, 0,
+    0, 0, 159, 255, 255, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    195, 255, 255, 127, 0, 0, 0, 0, 60, 255, 255, 246, 15, 0, 0, 0,
+    0, 0, 0, 0, 0, 37, 255, 255, 253, 30, 0, 0, 0, 0, 0, 216,
+    255, 255, 104, 0, 0, 0, 0, 0, 0, 0, 0, 135, 255, 255, 185, 0,
+    0, 0, 0, 0, 0, 117, 255, 255, 202, 0, 0, 0, 0, 0, 0, 0,
+    3, 229, 255, 255, 86, 0, 0, 0, 0, 0, 0, 23, 251, 255, 255, 44,
+    0, 0, 0, 0, 0, 0, 75, 255, 255, 236, 7, 0, 0, 0, 0, 0,
+    0, 0, 175, 255, 255, 142, 0, 0, 0, 0, 0, 0, 173, 255, 255, 144,
+    0, 0, 0, 0, 0, 0, 0, 0, 76, 255, 255, 234, 5, 0, 0, 0,
+    0, 20, 249, 255, 255, 46, 0, 0, 0, 0, 0, 0, 0, 0, 3, 229,
+    255, 255, 81, 0, 0, 0, 0, 113, 255, 255, 202, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 134, 255, 255, 179, 0, 0, 0, 0, 210, 255, 255,
+    103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 254, 255, 252, 24,
+    0, 0, 53, 255, 255, 245, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 192, 255, 255, 118, 0, 0, 150, 255, 255, 161, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 92, 255, 255, 215, 0, 8, 239, 255,
+    255, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 240,
+    255, 255, 58, 90, 255, 255, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 150, 255, 255, 155, 188, 255, 255, 120, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 255, 255, 245, 254,
+    255, 252, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 208, 255, 255, 255, 255, 178, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 109, 255, 255, 255, 255, 79, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 247,
+    255, 255, 232, 4, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 95,
+    0, 0, 0, 0, 0, 0, 0, 0, 21, 254, 255, 255, 183, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 189, 255, 255, 118, 142, 255, 255, 160, 0, 0,
+    0, 0, 0, 0, 0, 0, 85, 255, 255, 255, 243, 4, 0, 0, 0, 0,
+    0, 0, 0, 6, 246, 255, 255, 53, 77, 255, 255, 225, 0, 0, 0, 0,
+    0, 0, 0, 0, 149, 255, 255, 255, 255, 57, 0, 0, 0, 0, 0, 0,
+    0, 61, 255, 255, 241, 3, 15, 252, 255, 255, 33, 0, 0, 0, 0, 0,
+    0, 0, 214, 255, 199, 252, 255, 121, 0, 0, 0, 0, 0, 0, 0, 126,
+    255, 255, 179, 0, 0, 203, 255, 255, 98, 0, 0, 0, 0, 0, 0, 22,
+    255, 255, 122, 203, 255, 186, 0, 0, 0, 0, 0, 0, 0, 190, 255, 255,
+    114, 0, 0, 138, 255, 255, 163, 0, 0, 0, 0, 0, 0, 87, 255, 255,
+    58, 140, 255, 245, 5, 0, 0, 0, 0, 0, 7, 247, 255, 255, 48, 0,
+    0, 73, 255, 255, 227, 0, 0, 0, 0, 0, 0, 151, 255, 245, 5, 77,
+    255, 255, 59, 0, 0, 0, 0, 0, 63, 255, 255, 237, 2, 0, 0, 12,
+    251, 255, 255, 36, 0, 0, 0, 0, 0, 215, 255, 187, 0, 16, 253, 255,
+    124, 0, 0, 0, 0, 0, 127, 255, 255, 174, 0, 0, 0, 0, 199, 255,
+    255, 100, 0, 0, 0, 0, 24, 255, 255, 123, 0, 0, 207, 255, 188, 0,
+    0, 0, 0, 0, 192, 255, 255, 109, 0, 0, 0, 0, 134, 255, 255, 165,
+    0, 0, 0, 0, 88, 255, 255, 59, 0, 0, 144, 255, 246, 6, 0, 0,
+    0, 8, 247, 255, 255, 44, 0, 0, 0, 0, 69, 255, 255, 229, 0, 0,
+    0, 0, 153, 255, 245, 6, 0, 0, 81, 255, 255, 62, 0, 0, 0, 65,
+    255, 255, 233, 1, 0, 0, 0, 0, 10, 249, 255, 255, 38, 0, 0, 0,
+    217, 255, 188, 0, 0, 0, 19, 254, 255, 126, 0, 0, 0, 129, 255, 255,
+    169, 0, 0, 0, 0, 0, 0, 195, 255, 255, 103, 0, 0, 25, 255, 255,
+    124, 0, 0, 0, 0, 211, 255, 191, 0, 0, 0, 193, 255, 255, 104, 0,
+    0, 0, 0, 0, 0, 130, 255, 255, 168, 0, 0, 90, 255, 255, 60, 0,
+    0, 0, 0, 147, 255, 248, 8, 0, 8, 248, 255, 255, 39, 0, 0, 0,
+    0, 0, 0, 65, 255, 255, 231, 0, 0, 154, 255, 246, 6, 0, 0, 0,
+    0, 84, 255, 255, 64, 0, 66, 255, 255, 229, 0, 0, 0, 0, 0, 0,
+    0, 8, 248, 255, 255, 41, 0, 219, 255, 189, 0, 0, 0, 0, 0, 22,
+    255, 255, 129, 0, 131, 255, 255, 164, 0, 0, 0, 0, 0, 0, 0, 0,
+    191, 255, 255, 105, 26, 255, 255, 125, 0, 0, 0, 0, 0, 0, 214, 255,
+    193, 0, 195, 255, 255, 99, 0, 0, 0, 0, 0, 0, 0, 0, 126, 255,
+    255, 170, 91, 255, 255, 62, 0, 0, 0, 0, 0, 0, 151, 255, 249, 19,
+    249, 255, 255, 34, 0, 0, 0, 0, 0, 0, 0, 0, 61, 255, 255, 234,
+    156, 255, 247, 7, 0, 0, 0, 0, 0, 0, 88, 255, 255, 135, 255, 255,
+    225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 245, 255, 255, 243, 255,
+    190, 0, 0, 0, 0, 0, 0, 0, 25, 255, 255, 243, 255, 255, 159, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 255, 255, 255, 255, 127, 0,
+    0, 0, 0, 0, 0, 0, 0, 218, 255, 255, 255, 255, 94, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 122, 255, 255, 255, 255, 63, 0, 0, 0,
+    0, 0, 0, 0, 0, 155, 255, 255, 255, 255, 29, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 57, 255, 255, 255, 248, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 92, 255, 255, 255, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+    166, 255, 255, 188, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 255,
+    255, 241, 32, 0, 0, 18, 230, 255, 255, 106, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 235, 255, 255, 95, 0, 0, 0, 0, 77, 255, 255, 244, 34,
+    0, 0, 0, 0, 0, 0, 0, 183, 255, 255, 172, 0, 0, 0, 0, 0,
+    0, 160, 255, 255, 193, 1, 0, 0, 0, 0, 0, 107, 255, 255, 230, 19,
+    0, 0, 0, 0, 0, 0, 15, 227, 255, 255, 111, 0, 0, 0, 0, 39,
+    246, 255, 255, 71, 0, 0, 0, 0, 0, 0, 0, 0, 71, 255, 255, 245,
+    37, 0, 0, 5, 203, 255, 255, 147, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 154, 255, 255, 197, 2, 0, 132, 255, 255, 215, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 13, 224, 255, 255, 116, 58, 252, 255, 250,
+    51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 254, 255,
+    247, 225, 255, 255, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 148, 255, 255, 255, 255, 197, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 11, 221, 255, 255, 244, 34, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 234, 255,
+    255, 249, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 179, 255, 255, 255, 255, 207, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 103, 255, 255, 233, 216, 255, 255, 130, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 244, 255, 255, 76, 54,
+    252, 255, 251, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 201,
+    255, 255, 153, 0, 0, 135, 255, 255, 212, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 128, 255, 255, 219, 11, 0, 0, 6, 211, 255, 255, 136, 0,
+    0, 0, 0, 0, 0, 0, 0, 55, 251, 255, 252, 55, 0, 0, 0, 0,
+    50, 251, 255, 252, 56, 0, 0, 0, 0, 0, 0, 11, 218, 255, 255, 128,
+    0, 0, 0, 0, 0, 0, 129, 255, 255, 217, 9, 0, 0, 0, 0, 0,
+    153, 255, 255, 201, 4, 0, 0, 0, 0, 0, 0, 5, 206, 255, 255, 142,
+    0, 0, 0, 0, 76, 255, 255, 245, 37, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 249, 255, 253, 61, 0, 0, 22, 233, 255, 255, 103, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 123, 255, 255, 220, 11, 0, 178, 255, 255,
+    181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 202, 255, 255,
+    149, 0, 183, 255, 255, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 39, 247, 255, 254, 69, 0, 26, 238, 255, 255, 90, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 201, 255, 255, 148, 0, 0, 0, 90, 255, 255,
+    238, 26, 0, 0, 0, 0, 0, 0, 0, 0, 123, 255, 255, 219, 10, 0,
+    0, 0, 0, 170, 255, 255, 183, 0, 0, 0, 0, 0, 0, 0, 46, 249,
+    255, 252, 57, 0, 0, 0, 0, 0, 19, 231, 255, 255, 103, 0, 0, 0,
+    0, 0, 6, 208, 255, 255, 134, 0, 0, 0, 0, 0, 0, 0, 76, 255,
+    255, 244, 35, 0, 0, 0, 0, 133, 255, 255, 209, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 157, 255, 255, 195, 2, 0, 0, 54, 252, 255, 249, 47,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 223, 255, 255, 117, 0, 8,
+    215, 255, 255, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+    254, 255, 248, 44, 143, 255, 255, 198, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 143, 255, 255, 222, 253, 255, 245, 37, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 214, 255, 255, 255, 255,
+    106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    52, 251, 255, 255, 186, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208,
+    255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 255,
+    255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 208, 255, 255, 92, 0, 0, 0, 0,
+    0, 0, 0, 0, 52, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 32, 52, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 52, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 226, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 250,
+    255, 244, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 236, 255, 254, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 15, 215, 255, 255, 122, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 184, 255, 255, 163, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 255, 255, 199, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 255,
+    255, 225, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 65, 251, 255, 244, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 36, 237, 255, 254, 79, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 16, 216, 255, 255, 120, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 186, 255, 255, 162, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148, 255,
+    255, 197, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 105, 255, 255, 224, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 67, 251, 255, 243, 46, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 38, 238, 255, 253, 77, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 217, 255, 255, 118, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 187, 255,
+    255, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 149, 255, 255, 196, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 95, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 124, 144, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 124, 144, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 124,
+    64, 255, 255, 255, 255, 255, 255, 96, 64, 255, 255, 255, 255, 255, 255, 96,
+    64, 255, 255, 255, 255, 255, 255, 96, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 160, 0, 0, 0, 0, 64, 255, 255, 160, 0, 0, 0, 0,
+    64, 255, 255, 255, 255, 255, 255, 96, 64, 255, 255, 255, 255, 255, 255, 96,
+    64, 255, 255, 255, 255, 255, 255, 96, 216, 255, 207, 0, 0, 0, 0, 0,
+    0, 0, 0, 137, 255, 255, 31, 0, 0, 0, 0, 0, 0, 0, 57, 255,
+    255, 111, 0, 0, 0, 0, 0, 0, 0, 1, 230, 255, 191, 0, 0, 0,
+    0, 0, 0, 0, 0, 153, 255, 252, 19, 0, 0, 0, 0, 0, 0, 0,
+    73, 255, 255, 95, 0, 0, 0, 0, 0, 0, 0, 6, 241, 255, 175, 0,
+    0, 0, 0, 0, 0, 0, 0, 169, 255, 245, 9, 0, 0, 0, 0, 0,
+    0, 0, 89, 255, 255, 79, 0, 0, 0, 0, 0, 0, 0, 14, 249, 255,
+    159, 0, 0, 0, 0, 0, 0, 0, 0, 185, 255, 235, 3, 0, 0, 0,
+    0, 0, 0, 0, 105, 255, 255, 63, 0, 0, 0, 0, 0, 0, 0, 26,
+    254, 255, 143, 0, 0, 0, 0, 0, 0, 0, 0, 201, 255, 223, 0, 0,
+    0, 0, 0, 0, 0, 0, 121, 255, 255, 47, 0, 0, 0, 0, 0, 0,
+    0, 40, 255, 255, 127, 0, 0, 0, 0, 0, 0, 0, 0, 216, 255, 207,
+    0, 0, 0, 0, 0, 0, 0, 0, 137, 255, 255, 31, 0, 0, 0, 0,
+    0, 0, 0, 57, 255, 255, 111, 0, 0, 0, 0, 0, 0, 0, 1, 230,
+    255, 191, 0, 0, 0, 0, 0, 0, 0, 0, 153, 255, 252, 19, 0, 0,
+    0, 0, 0, 0, 0, 73, 255, 255, 95, 0, 0, 0, 0, 0, 0, 0,
+    6, 241, 255, 175, 0, 0, 0, 0, 0, 0, 0, 0, 169, 255, 245, 9,
+    0, 0, 0, 0, 0, 0, 0, 89, 255, 255, 79, 0, 0, 0, 0, 0,
+    0, 0, 14, 249, 255, 159, 228, 255, 255, 255, 255, 255, 188, 228, 255, 255,
+    255, 255, 255, 188, 228, 255, 255, 255, 255, 255, 188, 0, 0, 0, 40, 255,
+    255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188,
+    0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0,
+    0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40,
+    255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255,
+    188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0,
+    0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0,
+    40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255,
+    255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188,
+    0, 0, 0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 0, 0,
+    0, 40, 255, 255, 188, 0, 0, 0, 40, 255, 255, 188, 228, 255, 255, 255,
+    255, 255, 188, 228, 255, 255, 255, 255, 255, 188, 228, 255, 255, 255, 255, 255,
+    188, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255, 255, 105, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 255, 255,
+    255, 255, 254, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 124, 255, 255, 255, 217, 255, 255, 251, 78, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 109, 255, 255, 255, 119, 4, 162, 255, 255, 248, 67,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 254, 255, 253, 101, 0, 0,
+    1, 145, 255, 255, 244, 57, 0, 0, 0, 0, 0, 0, 0, 83, 252, 255,
+    249, 84, 0, 0, 0, 0, 0, 127, 255, 255, 239, 47, 0, 0, 0, 0,
+    0, 71, 249, 255, 244, 69, 0, 0, 0, 0, 0, 0, 0, 108, 254, 255,
+    233, 38, 0, 0, 0, 60, 245, 255, 238, 56, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 91, 251, 255, 226, 30, 0, 50, 240, 255, 229, 44, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 246, 255, 218, 24, 80, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 80,
+    80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 80, 80, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 80, 18, 217, 255, 243, 37, 0, 0, 0, 0, 0, 37, 237,
+    255, 206, 6, 0, 0, 0, 0, 0, 63, 249, 255, 145, 0, 0, 0, 0,
+    0, 0, 96, 255, 255, 78, 0, 0, 0, 0, 0, 0, 134, 255, 236, 28,
+    0, 0, 0, 0, 0, 1, 171, 255, 194, 3, 0, 0, 19, 80, 143, 195,
+    219, 241, 248, 229, 184, 110, 10, 0, 0, 0, 0, 0, 204, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 231, 57, 0, 0, 0, 0, 204, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 245, 38, 0, 0, 0, 182, 165, 94, 52,
+    30, 8, 9, 41, 113, 231, 255, 255, 186, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 24, 223, 255, 254, 36, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 98, 255, 255, 100, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 50, 255, 255, 147, 0, 0, 0, 8, 90, 167,
+    212, 239, 252, 255, 255, 255, 255, 255, 255, 165, 0, 0, 60, 223, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 178, 0, 40, 246, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 180, 0, 171, 255, 255, 232, 123,
+    61, 28, 10, 3, 0, 0, 47, 255, 255, 180, 0, 243, 255, 249, 34, 0,
+    0, 0, 0, 0, 0, 0, 76, 255, 255, 180, 13, 255, 255, 214, 0, 0,
+    0, 0, 0, 0, 0, 0, 164, 255, 255, 180, 4, 253, 255, 251, 29, 0,
+    0, 0, 0, 0, 0, 96, 254, 255, 255, 180, 0, 201, 255, 255, 221, 93,
+    27, 5, 17, 68, 170, 255, 255, 255, 255, 180, 0, 85, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 149, 255, 255, 180, 0, 0, 131, 255, 255, 255,
+    255, 255, 255, 255, 250, 119, 44, 255, 255, 180, 0, 0, 0, 60, 168, 227,
+    249, 239, 212, 144, 44, 0, 44, 255, 255, 180, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255,
+    204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255,
+    255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+    255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24, 255, 255, 204, 0, 6, 103, 192, 231, 248, 226, 164, 58, 0, 0, 0,
+    0, 24, 255, 255, 204, 27, 203, 255, 255, 255, 255, 255, 255, 254, 140, 0,
+    0, 0, 24, 255, 255, 210, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    136, 0, 0, 24, 255, 255, 255, 255, 246, 129, 39, 7, 21, 87, 216, 255,
+    255, 253, 58, 0, 24, 255, 255, 255, 250, 62, 0, 0, 0, 0, 0, 14,
+    205, 255, 255, 182, 0, 24, 255, 255, 255, 137, 0, 0, 0, 0, 0, 0,
+    0, 45, 255, 255, 253, 23, 24, 255, 255, 255, 35, 0, 0, 0, 0, 0,
+    0, 0, 0, 197, 255, 255, 79, 24, 255, 255, 235, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 140, 255, 255, 118, 24, 255, 255, 211, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 116, 255, 255, 135, 24, 255, 255, 211, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 116, 255, 255, 135, 24, 255, 255, 234, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 140, 255, 255, 118, 24, 255, 255, 255, 35,
+    0, 0, 0, 0, 0, 0, 0, 0, 197, 255, 255, 79, 24, 255, 255, 255,
+    137, 0, 0, 0, 0, 0, 0, 0, 45, 255, 255, 254, 23, 24, 255, 255,
+    255, 250, 61, 0, 0, 0, 0, 0, 14, 205, 255, 255, 183, 0, 24, 255,
+    255, 255, 255, 246, 128, 37, 6, 20, 86, 216, 255, 255, 254, 60, 0, 24,
+    255, 255, 211, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 139, 0, 0,
+    24, 255, 255, 204, 28, 206, 255, 255, 255, 255, 255, 255, 254, 143, 1, 0,
+    0, 24, 255, 255, 204, 0, 7, 107, 194, 233, 249, 227, 166, 60, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 51, 141, 205, 234, 250, 232, 207, 163, 86,
+    14, 0, 0, 0, 16, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 156,
+    0, 0, 20, 216, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 156, 0,
+    0, 186, 255, 255, 255, 190, 83, 26, 6, 22, 47, 91, 170, 141, 0, 74,
+    255, 255, 255, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 255,
+    255, 171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 242, 255, 255,
+    51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 255, 255, 239, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 255, 255, 212, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 255, 255, 212, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 32, 255, 255, 238, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 241, 255, 255, 51, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 177, 255, 255, 171, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 71, 255, 255, 255, 122, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 182, 255, 255, 255, 189, 82, 25, 5, 21, 46,
+    91, 169, 141, 0, 0, 19, 215, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 156, 0, 0, 0, 16, 174, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    156, 0, 0, 0, 0, 0, 56, 148, 211, 238, 250, 230, 206, 161, 85, 14,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 255, 255,
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 255,
+    255, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120,
+    255, 255, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    120, 255, 255, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 120, 255, 255, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 120, 255, 255, 104, 0, 0, 0, 0, 24, 136, 213, 244, 240, 211,
+    133, 28, 0, 120, 255, 255, 104, 0, 0, 0, 75, 239, 255, 255, 255, 255,
+    255, 255, 238, 75, 120, 255, 255, 104, 0, 0, 63, 249, 255, 255, 255, 255,
+    255, 255, 255, 255, 245, 166, 255, 255, 104, 0, 10, 222, 255, 255, 243, 121,
+    35, 6, 23, 93, 222, 255, 255, 255, 255, 104, 0, 102, 255, 255, 245, 51,
+    0, 0, 0, 0, 0, 19, 213, 255, 255, 255, 104, 0, 194, 255, 255, 121,
+    0, 0, 0, 0, 0, 0, 0, 57, 255, 255, 255, 104, 5, 247, 255, 254,
+    21, 0, 0, 0, 0, 0, 0, 0, 0, 209, 255, 255, 104, 35, 255, 255,
+    218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255, 104, 52, 255,
+    255, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 255, 255, 104, 52,
+    255, 255, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 255, 255, 104,
+    35, 255, 255, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255,
+    104, 5, 247, 255, 254, 21, 0, 0, 0, 0, 0, 0, 0, 0, 209, 255,
+    255, 104, 0, 195, 255, 255, 121, 0, 0, 0, 0, 0, 0, 0, 56, 255,
+    255, 255, 104, 0, 102, 255, 255, 245, 50, 0, 0, 0, 0, 0, 19, 213,
+    255, 255, 255, 104, 0, 10, 224, 255, 255, 242, 120, 34, 5, 22, 92, 222,
+    255, 255, 255, 255, 104, 0, 0, 65, 250, 255, 255, 255, 255, 255, 255, 255,
+    255, 246, 166, 255, 255, 104, 0, 0, 0, 78, 240, 255, 255, 255, 255, 255,
+    255, 240, 76, 120, 255, 255, 104, 0, 0, 0, 0, 26, 138, 214, 245, 241,
+    212, 136, 30, 0, 120, 255, 255, 104, 0, 0, 0, 0, 0, 55, 146, 210,
+    237, 250, 231, 186, 108, 8, 0, 0, 0, 0, 0, 0, 15, 172, 255, 255,
+    255, 255, 255, 255, 255, 255, 227, 53, 0, 0, 0, 0, 17, 212, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 245, 48, 0, 0, 0, 177, 255, 255,
+    245, 137, 54, 14, 4, 27, 95, 220, 255, 255, 216, 3, 0, 65, 255, 255,
+    230, 39, 0, 0, 0, 0, 0, 0, 13, 203, 255, 255, 86, 0, 171, 255,
+    255, 82, 0, 0, 0, 0, 0, 0, 0, 0, 54, 255, 255, 165, 1, 236,
+    255, 243, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 242, 255, 219, 29,
+    255, 255, 255, 252, 252, 252, 253, 253, 254, 254, 254, 255, 255, 255, 255, 240,
+    48, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    251, 52, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 252, 33, 255, 255, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 243, 255, 252, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 179, 255, 255, 134, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 70, 255, 255, 252, 93, 0, 0, 0, 0, 0,
+    0, 0, 0, 15, 137, 72, 0, 0, 177, 255, 255, 255, 183, 85, 30, 7,
+    9, 31, 83, 157, 244, 255, 80, 0, 0, 13, 204, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 80, 0, 0, 0, 9, 152, 252, 255, 255,
+    255, 255, 255, 255, 255, 255, 237, 116, 6, 0, 0, 0, 0, 0, 34, 129,
+    194, 230, 249, 243, 219, 166, 91, 8, 0, 0, 0, 0, 0, 0, 0, 53,
+    162, 220, 246, 255, 255, 224, 0, 0, 0, 0, 95, 253, 255, 255, 255, 255,
+    255, 224, 0, 0, 0, 16, 242, 255, 255, 255, 255, 255, 255, 224, 0, 0,
+    0, 85, 255, 255, 218, 58, 13, 0, 0, 0, 0, 0, 0, 121, 255, 255,
+    114, 0, 0, 0, 0, 0, 0, 0, 0, 131, 255, 255, 96, 0, 0, 0,
+    0, 0, 68, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 28, 68, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 28, 68, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 28, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0,
+    0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0,
+    0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255,
+    96, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0,
+    0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0,
+    0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255,
+    96, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0,
+    0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0,
+    0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255,
+    96, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0,
+    0, 0, 0, 0, 0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0,
+    0, 132, 255, 255, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 139,
+    213, 244, 240, 211, 134, 29, 0, 120, 255, 255, 104, 0, 0, 0, 81, 242,
+    255, 255, 255, 255, 255, 255, 239, 75, 120, 255, 255, 104, 0, 0, 68, 250,
+    255, 255, 255, 255, 255, 255, 255, 255, 246, 166, 255, 255, 104, 0, 12, 226,
+    255, 255, 241, 118, 34, 6, 22, 89, 218, 255, 255, 255, 255, 104, 0, 105,
+    255, 255, 242, 46, 0, 0, 0, 0, 0, 16, 209, 255, 255, 255, 104, 0,
+    197, 255, 255, 116, 0, 0, 0, 0, 0, 0, 0, 51, 255, 255, 255, 104,
+    6, 248, 255, 254, 19, 0, 0, 0, 0, 0, 0, 0, 0, 206, 255, 255,
+    104, 36, 255, 255, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 255,
+    255, 104, 52, 255, 255, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+    255, 255, 104, 53, 255, 255, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 255, 255, 104, 36, 255, 255, 217, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 151, 255, 255, 104, 6, 248, 255, 253, 18, 0, 0, 0, 0, 0, 0,
+    0, 0, 206, 255, 255, 104, 0, 197, 255, 255, 115, 0, 0, 0, 0, 0,
+    0, 0, 50, 255, 255, 255, 104, 0, 106, 255, 255, 241, 44, 0, 0, 0,
+    0, 0, 14, 206, 255, 255, 255, 104, 0, 12, 227, 255, 255, 239, 116, 33,
+    5, 21, 88, 216, 255, 255, 255, 255, 104, 0, 0, 71, 251, 255, 255, 255,
+    255, 255, 255, 255, 255, 246, 166, 255, 255, 100, 0, 0, 0, 84, 243, 255,
+    255, 255, 255, 255, 255, 239, 76, 130, 255, 255, 87, 0, 0, 0, 0, 29,
+    140, 215, 245, 241, 211, 135, 29, 0, 153, 255, 255, 70, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 255, 255, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 255, 255, 232, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 215, 255, 255, 144, 0, 0,
+    0, 31, 198, 117, 59, 33, 9, 10, 42, 116, 231, 255, 255, 248, 38, 0,
+    0, 0, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 117, 0,
+    0, 0, 0, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 115, 0,
+    0, 0, 0, 0, 0, 56, 135, 191, 217, 238, 250, 233, 199, 131, 29, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 1, 88, 183, 229, 249, 233, 180, 80,
+    0, 0, 0, 24, 255, 255, 204, 17, 185, 255, 255, 255, 255, 255, 255, 255,
+    160, 2, 0, 24, 255, 255, 210, 192, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 113, 0, 24, 255, 255, 255, 255, 237, 117, 37, 7, 15, 77, 215, 255,
+    255, 233, 5, 24, 255, 255, 255, 231, 34, 0, 0, 0, 0, 0, 22, 237,
+    255, 255, 63, 24, 255, 255, 255, 86, 0, 0, 0, 0, 0, 0, 0, 145,
+    255, 255, 111, 24, 255, 255, 245, 5, 0, 0, 0, 0, 0, 0, 0, 96,
+    255, 255, 132, 24, 255, 255, 212, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+    255, 255, 143, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    255, 255, 144, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 0,
+    0, 0, 0, 0, 0, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255,
+    228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228,
+    252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252,
+    255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 0, 0, 0, 0, 252,
+    255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228,
+    0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0,
+    252, 255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255,
+    228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228, 0,
+    0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0,
+    0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252,
+    255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228,
+    0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0,
+    0, 0, 252, 255, 228, 0, 0, 0, 0, 252, 255, 228, 0, 0, 0, 0,
+    252, 255, 228, 0, 0, 0, 1, 254, 255, 222, 0, 0, 0, 17, 255, 255,
+    209, 0, 0, 0, 67, 255, 255, 175, 0, 5, 50, 206, 255, 255, 120, 148,
+    255, 255, 255, 255, 249, 31, 148, 255, 255, 255, 255, 112, 0, 148, 253, 236,
+    183, 73, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 61, 239, 255, 255, 127, 0, 24, 255, 255, 204, 0,
+    0, 0, 0, 0, 0, 80, 247, 255, 253, 103, 0, 0, 24, 255, 255, 204,
+    0, 0, 0, 0, 0, 102, 252, 255, 248, 82, 0, 0, 0, 24, 255, 255,
+    204, 0, 0, 0, 0, 125, 255, 255, 240, 63, 0, 0, 0, 0, 24, 255,
+    255, 204, 0, 0, 2, 150, 255, 255, 231, 47, 0, 0, 0, 0, 0, 24,
+    255, 255, 204, 0, 7, 171, 255, 255, 218, 33, 0, 0, 0, 0, 0, 0,
+    24, 255, 255, 204, 14, 191, 255, 255, 204, 21, 0, 0, 0, 0, 0, 0,
+    0, 24, 255, 255, 220, 208, 255, 255, 187, 12, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 255, 255, 255, 255, 255, 242, 21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 219, 210, 255, 255, 202, 16, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 255, 255, 204, 20, 208, 255, 255, 203, 17, 0, 0,
+    0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 19, 207, 255, 255, 205, 18,
+    0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 18, 205, 255, 255,
+    206, 18, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 17, 203,
+    255, 255, 208, 19, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0,
+    15, 201, 255, 255, 209, 20, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0,
+    0, 0, 15, 200, 255, 255, 211, 21, 0, 0, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 14, 198, 255, 255, 212, 22, 0, 24, 255, 255, 204, 0,
+    0, 0, 0, 0, 0, 0, 13, 196, 255, 255, 214, 24, 252, 255, 228, 252,
+    255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255,
+    228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228,
+    252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252,
+    255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255, 228, 252, 255,
+    228, 252, 255, 228, 24, 255, 255, 204, 0, 4, 98, 190, 231, 247, 219, 155,
+    37, 0, 0, 0, 0, 55, 160, 218, 246, 237, 188, 82, 0, 0, 0, 24,
+    255, 255, 204, 23, 197, 255, 255, 255, 255, 255, 255, 246, 67, 0, 2, 133,
+    255, 255, 255, 255, 255, 255, 255, 147, 0, 0, 24, 255, 255, 210, 197, 255,
+    255, 255, 255, 255, 255, 255, 255, 243, 21, 132, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 88, 0, 24, 255, 255, 255, 255, 231, 106, 30, 5, 25, 112,
+    248, 255, 255, 189, 253, 253, 146, 49, 9, 12, 73, 216, 255, 255, 211, 0,
+    24, 255, 255, 255, 227, 27, 0, 0, 0, 0, 0, 102, 255, 255, 255, 254,
+    84, 0, 0, 0, 0, 0, 29, 246, 255, 255, 35, 24, 255, 255, 255, 82,
+    0, 0, 0, 0, 0, 0, 7, 246, 255, 255, 165, 0, 0, 0, 0, 0,
+    0, 0, 171, 255, 255, 82, 24, 255, 255, 244, 4, 0, 0, 0, 0, 0,
+    0, 0, 210, 255, 255, 76, 0, 0, 0, 0, 0, 0, 0, 126, 255, 255,
+    104, 24, 255, 255, 212, 0, 0, 0, 0, 0, 0, 0, 0, 197, 255, 255,
+    40, 0, 0, 0, 0, 0, 0, 0, 113, 255, 255, 115, 24, 255, 255, 204,
+    0, 0, 0, 0, 0, 0, 0, 0, 196, 255, 255, 32, 0, 0, 0, 0,
+    0, 0, 0, 112, 255, 255, 116, 24, 255, 255, 204, 0, 0, 0, 0, 0,
+    0, 0, 0, 196, 255, 255, 32, 0, 0, 0, 0, 0, 0, 0, 112, 255,
+    255, 116, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 196, 255,
+    255, 32, 0, 0, 0, 0, 0, 0, 0, 112, 255, 255, 116, 24, 255, 255,
+    204, 0, 0, 0, 0, 0, 0, 0, 0, 196, 255, 255, 32, 0, 0, 0,
+    0, 0, 0, 0, 112, 255, 255, 116, 24, 255, 255, 204, 0, 0, 0, 0,
+    0, 0, 0, 0, 196, 255, 255, 32, 0, 0, 0, 0, 0, 0, 0, 112,
+    255, 255, 116, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 196,
+    255, 255, 32, 0, 0, 0, 0, 0, 0, 0, 112, 255, 255, 116, 24, 255,
+    255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 196, 255, 255, 32, 0, 0,
+    0, 0, 0, 0, 0, 112, 255, 255, 116, 24, 255, 255, 204, 0, 0, 0,
+    0, 0, 0, 0, 0, 196, 255, 255, 32, 0, 0, 0, 0, 0, 0, 0,
+    112, 255, 255, 116, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0,
+    196, 255, 255, 32, 0, 0, 0, 0, 0, 0, 0, 112, 255, 255, 116, 24,
+    255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 196, 255, 255, 32, 0,
+    0, 0, 0, 0, 0, 0, 112, 255, 255, 116, 24, 255, 255, 204, 0, 1,
+    88, 183, 229, 249, 233, 180, 80, 0, 0, 0, 24, 255, 255, 204, 17, 185,
+    255, 255, 255, 255, 255, 255, 255, 160, 2, 0, 24, 255, 255, 210, 192, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 113, 0, 24, 255, 255, 255, 255, 237,
+    117, 37, 7, 15, 77, 215, 255, 255, 233, 5, 24, 255, 255, 255, 231, 34,
+    0, 0, 0, 0, 0, 22, 237, 255, 255, 63, 24, 255, 255, 255, 86, 0,
+    0, 0, 0, 0, 0, 0, 145, 255, 255, 111, 24, 255, 255, 245, 5, 0,
+    0, 0, 0, 0, 0, 0, 96, 255, 255, 132, 24, 255, 255, 212, 0, 0,
+    0, 0, 0, 0, 0, 0, 81, 255, 255, 143, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 80, 255, 255, 144, 0, 0, 0, 0, 6, 100,
+    179, 227, 248, 240, 213, 149, 53, 0, 0, 0, 0, 0, 0, 0, 51, 221,
+    255, 255, 255, 255, 255, 255, 255, 254, 158, 6, 0, 0, 0, 0, 52, 243,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 185, 2, 0, 0, 8, 218,
+    255, 255, 250, 140, 44, 8, 17, 76, 201, 255, 255, 255, 118, 0, 0, 98,
+    255, 255, 253, 75, 0, 0, 0, 0, 0, 5, 178, 255, 255, 237, 10, 0,
+    193, 255, 255, 146, 0, 0, 0, 0, 0, 0, 0, 19, 240, 255, 255, 88,
+    5, 247, 255, 255, 40, 0, 0, 0, 0, 0, 0, 0, 0, 150, 255, 255,
+    147, 34, 255, 255, 236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 255,
+    255, 185, 51, 255, 255, 211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+    255, 255, 203, 52, 255, 255, 211, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    65, 255, 255, 202, 34, 255, 255, 236, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 90, 255, 255, 185, 5, 247, 255, 255, 38, 0, 0, 0, 0, 0, 0,
+    0, 0, 149, 255, 255, 147, 0, 193, 255, 255, 143, 0, 0, 0, 0, 0,
+    0, 0, 17, 238, 255, 255, 87, 0, 98, 255, 255, 251, 68, 0, 0, 0,
+    0, 0, 4, 175, 255, 255, 237, 10, 0, 8, 218, 255, 255, 248, 136, 42,
+    7, 16, 75, 199, 255, 255, 255, 118, 0, 0, 0, 52, 244, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 185, 2, 0, 0, 0, 0, 52, 222, 255,
+    255, 255, 255, 255, 255, 255, 255, 159, 7, 0, 0, 0, 0, 0, 0, 6,
+    101, 180, 228, 249, 241, 215, 150, 53, 0, 0, 0, 0, 24, 255, 255, 204,
+    0, 6, 103, 192, 231, 248, 226, 164, 58, 0, 0, 0, 0, 24, 255, 255,
+    204, 27, 203, 255, 255, 255, 255, 255, 255, 254, 140, 0, 0, 0, 24, 255,
+    255, 210, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 136, 0, 0, 24,
+    255, 255, 255, 255, 246, 129, 39, 7, 21, 87, 216, 255, 255, 253, 58, 0,
+    24, 255, 255, 255, 250, 62, 0, 0, 0, 0, 0, 14, 205, 255, 255, 182,
+    0, 24, 255, 255, 255, 137, 0, 0, 0, 0, 0, 0, 0, 45, 255, 255,
+    253, 23, 24, 255, 255, 255, 35, 0, 0, 0, 0, 0, 0, 0, 0, 197,
+    255, 255, 79, 24, 255, 255, 235, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    140, 255, 255, 118, 24, 255, 255, 211, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 116, 255, 255, 135, 24, 255, 255, 211, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 116, 255, 255, 135, 24, 255, 255, 234, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 140, 255, 255, 118, 24, 255, 255, 255, 35, 0, 0, 0, 0,
+    0, 0, 0, 0, 197, 255, 255, 79, 24, 255, 255, 255, 137, 0, 0, 0,
+    0, 0, 0, 0, 45, 255, 255, 254, 23, 24, 255, 255, 255, 250, 61, 0,
+    0, 0, 0, 0, 14, 205, 255, 255, 183, 0, 24, 255, 255, 255, 255, 246,
+    128, 37, 6, 20, 86, 216, 255, 255, 254, 60, 0, 24, 255, 255, 211, 202,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 139, 0, 0, 24, 255, 255, 204,
+    28, 206, 255, 255, 255, 255, 255, 255, 254, 143, 1, 0, 0, 24, 255, 255,
+    204, 0, 7, 107, 194, 233, 249, 227, 166, 60, 0, 0, 0, 0, 24, 255,
+    255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+    255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 136, 213, 244, 240, 211, 133,
+    28, 0, 120, 255, 255, 104, 0, 0, 0, 75, 239, 255, 255, 255, 255, 255,
+    255, 238, 75, 120, 255, 255, 104, 0, 0, 63, 249, 255, 255, 255, 255, 255,
+    255, 255, 255, 245, 166, 255, 255, 104, 0, 10, 222, 255, 255, 243, 121, 35,
+    6, 23, 93, 222, 255, 255, 255, 255, 104, 0, 102, 255, 255, 245, 51, 0,
+    0, 0, 0, 0, 19, 213, 255, 255, 255, 104, 0, 194, 255, 255, 121, 0,
+    0, 0, 0, 0, 0, 0, 57, 255, 255, 255, 104, 5, 247, 255, 254, 21,
+    0, 0, 0, 0, 0, 0, 0, 0, 209, 255, 255, 104, 35, 255, 255, 218,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255, 104, 52, 255, 255,
+    195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 255, 255, 104, 52, 255,
+    255, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 255, 255, 104, 35,
+    255, 255, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 255, 255, 104,
+    5, 247, 255, 254, 21, 0, 0, 0, 0, 0, 0, 0, 0, 209, 255, 255,
+    104, 0, 195, 255, 255, 121, 0, 0, 0, 0, 0, 0, 0, 56, 255, 255,
+    255, 104, 0, 102, 255, 255, 245, 50, 0, 0, 0, 0, 0, 19, 213, 255,
+    255, 255, 104, 0, 10, 224, 255, 255, 242, 120, 34, 5, 22, 92, 222, 255,
+    255, 255, 255, 104, 0, 0, 65, 250, 255, 255, 255, 255, 255, 255, 255, 255,
+    246, 166, 255, 255, 104, 0, 0, 0, 78, 240, 255, 255, 255, 255, 255, 255,
+    240, 76, 120, 255, 255, 104, 0, 0, 0, 0, 26, 138, 214, 245, 241, 212,
+    136, 30, 0, 120, 255, 255, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 120, 255, 255, 104, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 120, 255, 255, 104, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 120, 255, 255, 104, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 120, 255, 255, 104, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 120, 255, 255, 104, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 255, 255, 104, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 255, 255, 104, 24, 255,
+    255, 204, 0, 3, 93, 182, 225, 249, 255, 36, 24, 255, 255, 204, 25, 197,
+    255, 255, 255, 255, 255, 37, 24, 255, 255, 210, 200, 255, 255, 255, 255, 255,
+    255, 39, 24, 255, 255, 255, 255, 240, 121, 39, 7, 0, 0, 0, 24, 255,
+    255, 255, 240, 42, 0, 0, 0, 0, 0, 0, 24, 255, 255, 255, 110, 0,
+    0, 0, 0, 0, 0, 0, 24, 255, 255, 254, 18, 0, 0, 0, 0, 0,
+    0, 0, 24, 255, 255, 223, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255,
+    255, 206, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255,
+    255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 255, 255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255,
+    255, 204, 0, 0, 0, 0, 0, 0, 0, 0, 24, 255, 255, 204, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 153, 209, 241, 251, 235, 214,
+    188, 123, 49, 1, 0, 0, 4, 156, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 44, 0, 0, 130, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 44, 0, 3, 237, 255, 255, 179, 69, 21, 4, 14, 37, 64, 130, 205,
+    42, 0, 27, 255, 255, 206, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 20, 255, 255, 186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 210, 255, 254, 126, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    62, 247, 255, 255, 253, 204, 151, 99, 36, 0, 0, 0, 0, 0, 0, 0,
+    44, 177, 251, 255, 255, 255, 255, 255, 210, 103, 4, 0, 0, 0, 0, 0,
+    0, 20, 83, 138, 195, 248, 255, 255, 255, 196, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 87, 219, 255, 255, 151, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 31, 253, 255, 241, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 226, 255, 255, 21, 62, 147, 22, 0, 0, 0, 0,
+    0, 0, 0, 39, 252, 255, 255, 8, 68, 255, 248, 166, 88, 33, 8, 12,
+    38, 114, 230, 255, 255, 197, 0, 68, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 252, 61, 0, 4, 105, 229, 255, 255, 255, 255, 255, 255, 255,
+    255, 235, 77, 0, 0, 0, 0, 5, 83, 165, 221, 247, 248, 229, 184, 110,
+    16, 0, 0, 0, 0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255,
+    255, 220, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255, 255, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0,
+    36, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 36, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 200, 36, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 200, 0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255,
+    255, 220, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255, 255, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 255, 255, 220, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255,
+    255, 220, 0, 0, 0, 0, 0, 0, 0, 0, 8, 255, 255, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 255, 255, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 254, 255, 226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 239,
+    255, 251, 10, 0, 0, 0, 0, 0, 0, 0, 0, 196, 255, 255, 151, 31,
+    3, 0, 0, 0, 0, 0, 0, 118, 255, 255, 255, 255, 255, 255, 255, 200,
+    0, 0, 0, 11, 210, 255, 255, 255, 255, 255, 255, 200, 0, 0, 0, 0,
+    11, 119, 196, 236, 251, 255, 255, 200, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 72, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 255, 255, 96, 71, 255, 255, 152, 0, 0, 0, 0,
+    0, 0, 0, 0, 137, 255, 255, 96, 61, 255, 255, 167, 0, 0, 0, 0,
+    0, 0, 0, 0, 175, 255, 255, 96, 39, 255, 255, 217, 0, 0, 0, 0,
+    0, 0, 0, 21, 244, 255, 255, 96, 2, 244, 255, 255, 76, 0, 0, 0,
+    0, 0, 7, 182, 255, 255, 255, 96, 0, 166, 255, 255, 243, 107, 25, 4,
+    23, 87, 208, 255, 255, 255, 255, 96, 0, 44, 249, 255, 255, 255, 255, 255,
+    255, 255, 255, 237, 165, 255, 255, 96, 0, 0, 92, 251, 255, 255, 255, 255,
+    255, 255, 226, 54, 128, 255, 255, 96, 0, 0, 0, 43, 158, 223, 248, 239,
+    205, 121, 16, 0, 128, 255, 255, 96, 0, 220, 255, 255, 46, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 63, 255, 255, 204, 0, 128, 255, 255, 138, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 155, 255, 255, 111, 0, 35, 255, 255,
+    228, 2, 0, 0, 0, 0, 0, 0, 0, 7, 239, 255, 251, 22, 0, 0,
+    198, 255, 255, 67, 0, 0, 0, 0, 0, 0, 0, 84, 255, 255, 180, 0,
+    0, 0, 104, 255, 255, 160, 0, 0, 0, 0, 0, 0, 0, 177, 255, 255,
+    87, 0, 0, 0, 17, 249, 255, 243, 10, 0, 0, 0, 0, 0, 19, 250,
+    255, 241, 9, 0, 0, 0, 0, 174, 255, 255, 89, 0, 0, 0, 0, 0,
+    106, 255, 255, 156, 0, 0, 0, 0, 0, 80, 255, 255, 182, 0, 0, 0,
+    0, 0, 199, 255, 255, 63, 0, 0, 0, 0, 0, 6, 237, 255, 252, 23,
+    0, 0, 0, 36, 255, 255, 224, 1, 0, 0, 0, 0, 0, 0, 150, 255,
+    255, 111, 0, 0, 0, 128, 255, 255, 132, 0, 0, 0, 0, 0, 0, 0,
+    56, 255, 255, 204, 0, 0, 0, 220, 255, 255, 39, 0, 0, 0, 0, 0,
+    0, 0, 0, 218, 255, 255, 41, 0, 58, 255, 255, 202, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 126, 255, 255, 133, 0, 150, 255, 255, 108, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 33, 254, 255, 224, 7, 236, 255, 250, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 195, 255, 255, 143, 255, 255,
+    178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 255, 255, 254,
+    255, 255, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 248,
+    255, 255, 255, 239, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 171, 255, 255, 255, 154, 0, 0, 0, 0, 0, 0, 136, 255, 255, 88,
+    0, 0, 0, 0, 0, 0, 189, 255, 255, 231, 0, 0, 0, 0, 0, 0,
+    45, 255, 255, 178, 70, 255, 255, 153, 0, 0, 0, 0, 0, 7, 246, 255,
+    255, 255, 41, 0, 0, 0, 0, 0, 110, 255, 255, 113, 11, 250, 255, 219,
+    0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 107, 0, 0, 0, 0, 0,
+    175, 255, 255, 48, 0, 196, 255, 255, 28, 0, 0, 0, 0, 128, 255, 251,
+    224, 255, 172, 0, 0, 0, 0, 2, 238, 255, 237, 2, 0, 131, 255, 255,
+    94, 0, 0, 0, 0, 194, 255, 197, 150, 255, 236, 1, 0, 0, 0, 50,
+    255, 255, 174, 0, 0, 66, 255, 255, 159, 0, 0, 0, 9, 249, 255, 132,
+    85, 255, 255, 47, 0, 0, 0, 115, 255, 255, 109, 0, 0, 8, 248, 255,
+    225, 0, 0, 0, 68, 255, 255, 66, 21, 254, 255, 113, 0, 0, 0, 180,
+    255, 255, 44, 0, 0, 0, 192, 255, 255, 34, 0, 0, 133, 255, 248, 8,
+    0, 210, 255, 178, 0, 0, 3, 241, 255, 234, 1, 0, 0, 0, 127, 255,
+    255, 100, 0, 0, 198, 255, 191, 0, 0, 145, 255, 240, 3, 0, 54, 255,
+    255, 170, 0, 0, 0, 0, 62, 255, 255, 165, 0, 12, 251, 255, 125, 0,
+    0, 80, 255, 255, 53, 0, 120, 255, 255, 104, 0, 0, 0, 0, 6, 246,
+    255, 230, 0, 73, 255, 255, 60, 0, 0, 16, 253, 255, 119, 0, 185, 255,
+    255, 39, 0, 0, 0, 0, 0, 187, 255, 255, 40, 138, 255, 244, 5, 0,
+    0, 0, 205, 255, 184, 5, 244, 255, 230, 0, 0, 0, 0, 0, 0, 122,
+    255, 255, 106, 203, 255, 184, 0, 0, 0, 0, 140, 255, 244, 65, 255, 255,
+    165, 0, 0, 0, 0, 0, 0, 57, 255, 255, 186, 252, 255, 119, 0, 0,
+    0, 0, 74, 255, 255, 184, 255, 255, 100, 0, 0, 0, 0, 0, 0, 4,
+    243, 255, 255, 255, 255, 53, 0, 0, 0, 0, 13, 251, 255, 255, 255, 255,
+    35, 0, 0, 0, 0, 0, 0, 0, 183, 255, 255, 255, 240, 3, 0, 0,
+    0, 0, 0, 200, 255, 255, 255, 226, 0, 0, 0, 0, 0, 0, 0, 0,
+    118, 255, 255, 255, 178, 0, 0, 0, 0, 0, 0, 134, 255, 255, 255, 161,
+    0, 0, 0, 0, 0, 0, 0, 0, 53, 255, 255, 255, 112, 0, 0, 0,
+    0, 0, 0, 69, 255, 255, 255, 96, 0, 0, 0, 0, 0, 44, 247, 255,
+    253, 66, 0, 0, 0, 0, 0, 0, 0, 54, 250, 255, 251, 55, 0, 0,
+    106, 255, 255, 229, 19, 0, 0, 0, 0, 0, 13, 220, 255, 255, 122, 0,
+    0, 0, 0, 176, 255, 255, 178, 0, 0, 0, 0, 0, 163, 255, 255, 191,
+    2, 0, 0, 0, 0, 18, 227, 255, 255, 108, 0, 0, 0, 93, 255, 255,
+    237, 27, 0, 0, 0, 0, 0, 0, 63, 253, 255, 247, 46, 0, 36, 242,
+    255, 255, 80, 0, 0, 0, 0, 0, 0, 0, 0, 132, 255, 255, 213, 15,
+    202, 255, 255, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 198, 255,
+    255, 225, 255, 255, 213, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    32, 240, 255, 255, 255, 247, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 119, 255, 255, 255, 119, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 16, 225, 255, 255, 255, 192, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 170, 255, 255, 254, 255, 255, 123, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 100, 255, 255, 231, 73, 250, 255, 251, 56,
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 244, 255, 254, 70, 0, 118, 255,
+    255, 222, 14, 0, 0, 0, 0, 0, 0, 6, 206, 255, 255, 140, 0, 0,
+    1, 187, 255, 255, 165, 0, 0, 0, 0, 0, 0, 142, 255, 255, 206, 6,
+    0, 0, 0, 25, 235, 255, 255, 93, 0, 0, 0, 0, 71, 254, 255, 245,
+    39, 0, 0, 0, 0, 0, 77, 255, 255, 242, 35, 0, 0, 22, 232, 255,
+    255, 100, 0, 0, 0, 0, 0, 0, 0, 149, 255, 255, 201, 5, 1, 182,
+    255, 255, 172, 0, 0, 0, 0, 0, 0, 0, 0, 8, 211, 255, 255, 135,
+    0, 216, 255, 255, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 255,
+    255, 200, 0, 114, 255, 255, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    165, 255, 255, 99, 0, 19, 248, 255, 239, 8, 0, 0, 0, 0, 0, 0,
+    0, 17, 247, 255, 241, 11, 0, 0, 164, 255, 255, 91, 0, 0, 0, 0,
+    0, 0, 0, 108, 255, 255, 151, 0, 0, 0, 61, 255, 255, 191, 0, 0,
+    0, 0, 0, 0, 0, 207, 255, 255, 50, 0, 0, 0, 0, 214, 255, 254,
+    35, 0, 0, 0, 0, 0, 51, 255, 255, 204, 0, 0, 0, 0, 0, 112,
+    255, 255, 134, 0, 0, 0, 0, 0, 151, 255, 255, 102, 0, 0, 0, 0,
+    0, 17, 247, 255, 229, 3, 0, 0, 0, 9, 240, 255, 243, 13, 0, 0,
+    0, 0, 0, 0, 162, 255, 255, 77, 0, 0, 0, 94, 255, 255, 155, 0,
+    0, 0, 0, 0, 0, 0, 59, 255, 255, 176, 0, 0, 0, 193, 255, 255,
+    53, 0, 0, 0, 0, 0, 0, 0, 0, 212, 255, 251, 24, 0, 37, 255,
+    255, 207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 255, 255, 119, 0,
+    136, 255, 255, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 246, 255,
+    217, 4, 231, 255, 245, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    160, 255, 255, 141, 255, 255, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 57, 255, 255, 255, 255, 255, 56, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 210, 255, 255, 255, 210, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 108, 255, 255, 255, 109, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 255, 255, 246, 16, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 255, 255, 161, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 255, 255,
+    60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 255,
+    255, 219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 66,
+    222, 255, 255, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 255,
+    255, 255, 255, 255, 229, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    120, 255, 255, 255, 255, 253, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 120, 255, 255, 242, 187, 63, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    108, 60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108,
+    60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 89, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 250, 255, 161, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 45, 241, 255, 189, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 26, 227, 255, 212, 15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 207, 255, 230, 30, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 183, 255, 243, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    154, 255, 252, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 255,
+    255, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 254, 255, 135,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 249, 255, 167, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 41, 238, 255, 194, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 223, 255, 216, 18, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 203, 255, 233, 34, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 108, 160, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    108, 160, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 108,
+    0, 0, 0, 0, 0, 0, 19, 122, 191, 229, 245, 255, 92, 0, 0, 0,
+    0, 0, 29, 231, 255, 255, 255, 255, 255, 92, 0, 0, 0, 0, 0, 154,
+    255, 255, 255, 255, 255, 255, 92, 0, 0, 0, 0, 0, 228, 255, 255, 157,
+    43, 9, 0, 0, 0, 0, 0, 0, 13, 255, 255, 238, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 29, 255, 255, 200, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 35, 255, 255, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+    255, 255, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 255, 255, 192,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 255, 255, 190, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 61, 255, 255, 180, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 135, 255, 255, 147, 0, 0, 0, 0, 0, 0, 6, 35, 120,
+    250, 255, 255, 72, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 152,
+    0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 243, 96, 0, 0, 0, 0,
+    0, 0, 0, 255, 255, 255, 255, 255, 253, 125, 0, 0, 0, 0, 0, 0,
+    0, 7, 40, 134, 253, 255, 255, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 151, 255, 255, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 255,
+    255, 173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 255, 255, 188, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 36, 255, 255, 192, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 36, 255, 255, 192, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 36, 255, 255, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+    255, 255, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 255, 255, 205,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 254, 255, 244, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 220, 255, 255, 166, 45, 8, 0, 0, 0,
+    0, 0, 0, 0, 142, 255, 255, 255, 255, 255, 255, 92, 0, 0, 0, 0,
+    0, 21, 223, 255, 255, 255, 255, 255, 92, 0, 0, 0, 0, 0, 0, 15,
+    117, 189, 229, 246, 255, 92, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240,
+    255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255,
+    184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184,
+    240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240,
+    255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255,
+    184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184, 240, 255, 184,
+    240, 255, 184, 240, 255, 184, 255, 249, 237, 206, 152, 53, 0, 0, 0, 0,
+    0, 0, 0, 255, 255, 255, 255, 255, 253, 95, 0, 0, 0, 0, 0, 0,
+    255, 255, 255, 255, 255, 255, 235, 6, 0, 0, 0, 0, 0, 0, 4, 24,
+    94, 245, 255, 255, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 255,
+    255, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 255, 255, 116, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 100, 255, 255, 123, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 100, 255, 255, 124, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 100, 255, 255, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99,
+    255, 255, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 255, 255, 148,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 255, 255, 218, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 234, 255, 255, 175, 56, 12, 0, 0, 0,
+    0, 0, 0, 0, 76, 245, 255, 255, 255, 255, 255, 92, 0, 0, 0, 0,
+    0, 0, 39, 211, 255, 255, 255, 255, 92, 0, 0, 0, 0, 0, 53, 233,
+    255, 255, 255, 255, 255, 92, 0, 0, 0, 0, 1, 217, 255, 255, 188, 63,
+    14, 1, 0, 0, 0, 0, 0, 44, 255, 255, 229, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 82, 255, 255, 157, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 97, 255, 255, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 255,
+    255, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 255, 255, 124, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 100, 255, 255, 124, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 101, 255, 255, 123, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 114, 255, 255, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161,
+    255, 255, 94, 0, 0, 0, 0, 0, 0, 4, 26, 101, 249, 255, 255, 52,
+    0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 227, 2, 0, 0, 0,
+    0, 0, 255, 255, 255, 255, 255, 251, 81, 0, 0, 0, 0, 0, 0, 255,
+    250, 238, 205, 148, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    24, 0, 0, 12, 112, 192, 235, 247, 221, 176, 99, 21, 0, 0, 0, 0,
+    0, 0, 0, 31, 185, 108, 0, 93, 235, 255, 255, 255, 255, 255, 255, 255,
+    251, 187, 107, 45, 11, 17, 64, 152, 249, 255, 108, 125, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 80,
+    156, 255, 242, 137, 53, 14, 18, 55, 125, 206, 255, 255, 255, 255, 255, 255,
+    255, 255, 220, 64, 0, 156, 169, 22, 0, 0, 0, 0, 0, 0, 0, 33,
+    113, 188, 227, 249, 231, 181, 95, 4, 0, 0, 42, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static constexpr BakedGlyph kBakedGlyphs32[] = {
+    {0x20, 0, 0, 0, 0, 10, 0},
+    {0x21, 4, 23, 4, 23, 13, 0},
+    {0x22, 3, 23, 9, 9, 15, 92},
+    {0x23, 2, 23, 23, 23, 27, 173},
+    {0x24, 2, 25, 16, 30, 20, 702},
+    {0x25, 1, 23, 28, 23, 30, 1182},
+    {0x26, 2, 23, 22, 23, 25, 1826},
+    {0x27, 3, 23, 3, 9, 9, 2332},
+    {0x28, 2, 24, 8, 29, 12, 2359},
+    {0x29, 2, 24, 8, 29, 12, 2591},
+    {0x2A, 0, 23, 16, 14, 16, 2823},
+    {0x2B, 3, 21, 21, 21, 27, 3047},
+    {0x2C, 2, 4, 6, 8, 10, 3488},
+    {0x2D, 1, 10, 9, 3, 12, 3536},
+    {0x2E, 3, 4, 4, 4, 10, 3563},
+    {0x2F, 0, 23, 11, 26, 11, 3579},
+    {0x30, 2, 23, 17, 23, 20, 3865},
+    {0x31, 3, 23, 15, 23, 20, 4256},
+    {0x32, 2, 23, 16, 23, 20, 4601},
+    {0x33, 2, 23, 16, 23, 20, 4969},
+    {0x34, 1, 23, 18, 23, 20, 5337},
+    {0x35, 2, 23, 16, 23, 20, 5751},
+    {0x36, 2, 23, 17, 23, 20, 6119},
+    {0x37, 2, 23, 16, 23, 20, 6510},
+    {0x38, 2, 23, 17, 23, 20, 6878},
+    {0x39, 2, 23, 17, 23, 20, 7269},
+    {0x3A, 3, 17, 5, 17, 11, 7660},
+    {0x3B, 2, 17, 6, 21, 11, 7745},
+    {0x3C, 3, 19, 21, 17, 27, 7871},
+    {0x3D, 3, 15, 21, 10, 27, 8228},
+    {0x3E, 3, 19, 21, 17, 27, 8438},
+    {0x3F, 2, 23, 13, 23, 17, 8795},
+    {0x40, 2, 23, 28, 28, 32, 9094},
+    {0x41, 0, 23, 22, 23, 22, 9878},
+    {0x42, 3, 23, 17, 23, 22, 10384},
+    {0x43, 1, 23, 20, 23, 22, 10775},
+    {0x44, 3, 23, 20, 23, 25, 11235},
+    {0x45, 3, 23, 16, 23, 20, 11695},
+    {0x46, 3, 23, 14, 23, 18, 12063},
+    {0x47, 1, 23, 22, 23, 25, 12385},
+    {0x48, 3, 23, 18, 23, 24, 12891},
+    {0x49, 3, 23, 4, 23, 9, 13305},
+    {0x4A, -2, 23, 9, 29, 9, 13397},
+    {0x4B, 3, 23, 19, 23, 21, 13658},
+    {0x4C, 3, 23, 15, 23, 18, 14095},
+    {0x4D, 3, 23, 22, 23, 28, 14440},
+    {0x4E, 3, 23, 18, 23, 24, 14946},
+    {0x4F, 1, 23, 23, 23, 25, 15360},
+    {0x50, 3, 23, 16, 23, 19, 15889},
+    {0x51, 1, 23, 23, 27, 25, 16257},
+    {0x52, 3, 23, 19, 23, 22, 16878},
+    {0x53, 2, 23, 17, 23, 20, 17315},
+    {0x54, -1, 23, 21, 23, 20, 17706},
+    {0x55, 2, 23, 19, 23, 23, 18189},
+    {0x56, 0, 23, 22, 23, 22, 18626},
+    {0x57, 1, 23, 30, 23, 32, 19132},
+    {0x58, 0, 23, 21, 23, 22, 19822},
+    {0x59, -1, 23, 21, 23, 20, 20305},
+    {0x5A, 1, 23, 20, 23, 22, 20788},
+    {0x5B, 2, 24, 8, 29, 12, 21248},
+    {0x5C, 0, 23, 11, 26, 11, 21480},
+    {0x5D, 3, 24, 7, 29, 12, 21766},
+    {0x5E, 3, 23, 21, 9, 27, 21969},
+    {0x5F, -1, -5, 18, 3, 16, 22158},
+    {0x60, 2, 26, 9, 6, 16, 22212},
+    {0x61, 1, 18, 16, 18, 20, 22266},
+    {0x62, 2, 24, 17, 24, 20, 22554},
+    {0x63, 1, 18, 15, 18, 18, 22962},
+    {0x64, 1, 24, 17, 24, 20, 23232},
+    {0x65, 1, 18, 17, 18, 20, 23640},
+    {0x66, 0, 24, 12, 24, 11, 23946},
+    {0x67, 1, 18, 17, 25, 20, 24234},
+    {0x68, 2, 24, 16, 24, 20, 24659},
+    {0x69, 3, 24, 3, 24, 9, 25043},
+    {0x6A, -1, 24, 7, 31, 9, 25115},
+    {0x6B, 2, 24, 17, 24, 19, 25332},
+    {0x6C, 3, 24, 3, 24, 9, 25740},
+    {0x6D, 2, 18, 27, 18, 31, 25812},
+    {0x6E, 2, 18, 16, 18, 20, 26298},
+    {0x6F, 1, 18, 17, 18, 20, 26586},
+    {0x70, 2, 18, 17, 25, 20, 26892},
+    {0x71, 1, 18, 17, 25, 20, 27317},
+    {0x72, 2, 18, 12, 18, 13, 27742},
+    {0x73, 1, 18, 15, 18, 17, 27958},
+    {0x74, 0, 23, 12, 23, 13, 28228},
+    {0x75, 2, 18, 16, 18, 20, 28504},
+    {0x76, 0, 18, 18, 18, 19, 28792},
+    {0x77, 1, 18, 24, 18, 26, 29116},
+    {0x78, 0, 18, 18, 18, 19, 29548},
+    {0x79, 0, 18, 18, 25, 19, 29872},
+    {0x7A, 1, 18, 15, 18, 17, 30322},
+    {0x7B, 4, 24, 13, 30, 20, 30592},
+    {0x7C, 4, 24, 3, 32, 11, 30982},
+    {0x7D, 4, 24, 13, 30, 20, 31078},
+    {0x7E, 3, 14, 21, 7, 27, 31468},
+};
+
+static constexpr BakedKerning kBakedKerning32[] = {
+    {0x2D, 0x41, -1},
+    {0x2D, 0x42, -1},
+    {0x2D, 0x47, 1},
+    {0x2D, 0x4A, 2},
+    {0x2D, 0x4F, 1},
+    {0x2D, 0x51, 1},
+    {0x2D, 0x54, -3},
+    {0x2D, 0x56, -2},
+    {0x2D, 0x57, -1},
+    {0x2D, 0x58, -2},
+    {0x2D, 0x59, -4},
+    {0x2D, 0x6F, 1},
+    {0x2D, 0x76, -1},
+    {0x2D, 0x79, -1},
+    {0x41, 0x2D, -1},
+    {0x41, 0x2E, -1},
+    {0x41, 0x3A, -1},
+    {0x41, 0x41, 1},
+    {0x41, 0x43, -1},
+    {0x41, 0x47, -1},
+    {0x41, 0x4F, -1},
+    {0x41, 0x51, -1},
+    {0x41, 0x54, -2},
+    {0x41, 0x56, -2},
+    {0x41, 0x57, -2},
+    {0x41, 0x59, -2},
+    {0x41, 0x63, -1},
+    {0x41, 0x64, -1},
+    {0x41, 0x65, -1},
+    {0x41, 0x66, -1},
+    {0x41, 0x6F, -1},
+    {0x41, 0x71, -1},
+    {0x41, 0x74, -1},
+    {0x41, 0x76, -2},
+    {0x41, 0x77, -1},
+    {0x41, 0x79, -2},
+    {0x42, 0x43, -1},
+    {0x42, 0x47, -1},
+    {0x42, 0x4F, -1},
+    {0x42, 0x53, -1},
+    {0x42, 0x56, -1},
+    {0x42, 0x57, -1},
+    {0x42, 0x59, -2},
+    {0x43, 0x59, -1},
+    {0x44, 0x41, -1},
+    {0x44, 0x56, -1},
+    {0x44, 0x59, -2},
+    {0x46, 0x2E, -5},
+    {0x46, 0x3A, -2},
+    {0x46, 0x41, -3},
+    {0x46, 0x53, -1},
+    {0x46, 0x54, -1},
+    {0x46, 0x61, -3},
+    {0x46, 0x65, -2},
+    {0x46, 0x69, -2},
+    {0x46, 0x6F, -1},
+    {0x46, 0x72, -2},
+    {0x46, 0x75, -2},
+    {0x46, 0x79, -3},
+    {0x47, 0x54, -1},
+    {0x47, 0x59, -2},
+    {0x48, 0x2E, -1},
+    {0x4A, 0x2D, -1},
+    {0x4A, 0x41, -1},
+    {0x4B, 0x2D, -3},
+    {0x4B, 0x41, -1},
+    {0x4B, 0x43, -2},
+    {0x4B, 0x4F, -2},
+    {0x4B, 0x54, -2},
+    {0x4B, 0x55, -1},
+    {0x4B, 0x57, -1},
+    {0x4B, 0x59, -1},
+    {0x4B, 0x61, -1},
+    {0x4B, 0x65, -2},
+    {0x4B, 0x6F, -2},
+    {0x4B, 0x75, -2},
+    {0x4B, 0x79, -2},
+    {0x4C, 0x2D, -1},
+    {0x4C, 0x41, 1},
+    {0x4C, 0x4F, -1},
+    {0x4C, 0x54, -4},
+    {0x4C, 0x55, -2},
+    {0x4C, 0x56, -4},
+    {0x4C, 0x57, -3},
+    {0x4C, 0x59, -4},
+    {0x4C, 0x65, -1},
+    {0x4C, 0x6F, -1},
+    {0x4C, 0x75, -1},
+    {0x4C, 0x79, -3},
+    {0x4F, 0x2D, 1},
+    {0x4F, 0x2E, -1},
+    {0x4F, 0x3A, -1},
+    {0x4F, 0x41, -1},
+    {0x4F, 0x56, -1},
+    {0x4F, 0x58, -2},
+    {0x4F, 0x59, -2},
+    {0x50, 0x2D, -1},
+    {0x50, 0x2E, -5},
+    {0x50, 0x41, -2},
+    {0x50, 0x59, -1},
+    {0x50, 0x61, -1},
+    {0x50, 0x65, -1},
+    {0x50, 0x69, -1},
+    {0x50, 0x6E, -1},
+    {0x50, 0x6F, -1},
+    {0x50, 0x72, -1},
+    {0x50, 0x73, -1},
+    {0x50, 0x75, -1},
+    {0x51, 0x2D, 1},
+    {0x52, 0x2D, -1},
+    {0x52, 0x2E, -1},
+    {0x52, 0x3A, -1},
+    {0x52, 0x41, -1},
+    {0x52, 0x43, -2},
+    {0x52, 0x54, -2},
+    {0x52, 0x56, -2},
+    {0x52, 0x57, -1},
+    {0x52, 0x59, -2},
+    {0x52, 0x61, -1},
+    {0x52, 0x65, -1},
+    {0x52, 0x6F, -1},
+    {0x52, 0x75, -1},
+    {0x52, 0x79, -2},
+    {0x53, 0x41, 1},
+    {0x54, 0x2D, -3},
+    {0x54, 0x2E, -4},
+    {0x54, 0x3A, -4},
+    {0x54, 0x41, -2},
+    {0x54, 0x43, -2},
+    {0x54, 0x54, -1},
+    {0x54, 0x61, -5},
+    {0x54, 0x63, -5},
+    {0x54, 0x65, -5},
+    {0x54, 0x69, -1},
+    {0x54, 0x6F, -5},
+    {0x54, 0x72, -5},
+    {0x54, 0x73, -5},
+    {0x54, 0x75, -5},
+    {0x54, 0x77, -5},
+    {0x54, 0x79, -5},
+    {0x55, 0x5A, -1},
+    {0x56, 0x2D, -2},
+    {0x56, 0x2E, -4},
+    {0x56, 0x3A, -3},
+    {0x56, 0x41, -2},
+    {0x56, 0x4F, -1},
+    {0x56, 0x61, -2},
+    {0x56, 0x65, -2},
+    {0x56, 0x69, -1},
+    {0x56, 0x6F, -2},
+    {0x56, 0x75, -2},
+    {0x56, 0x79, -1},
+    {0x57, 0x2D, -1},
+    {0x57, 0x2E, -4},
+    {0x57, 0x3A, -2},
+    {0x57, 0x41, -2},
+    {0x57, 0x61, -2},
+    {0x57, 0x65, -2},
+    {0x57, 0x69, -1},
+    {0x57, 0x6F, -2},
+    {0x57, 0x72, -1},
+    {0x57, 0x75, -1},
+    {0x57, 0x79, -1},
+    {0x58, 0x2D, -2},
+    {0x58, 0x43, -2},
+    {0x58, 0x4F, -2},
+    {0x58, 0x54, -1},
+    {0x58, 0x65, -1},
+    {0x59, 0x2D, -4},
+    {0x59, 0x2E, -6},
+    {0x59, 0x3A, -4},
+    {0x59, 0x41, -2},
+    {0x59, 0x43, -2},
+    {0x59, 0x4F, -2},
+    {0x59, 0x61, -4},
+    {0x59, 0x65, -4},
+    {0x59, 0x69, -1},
+    {0x59, 0x6F, -4},
+    {0x59, 0x75, -4},
+    {0x5A, 0x2D, -1},
+    {0x65, 0x78, -1},
+    {0x66, 0x2D, -2},
+    {0x66, 0x2E, -2},
+    {0x66, 0x3A, -1},
+    {0x66, 0x74, -1},
+    {0x66, 0x77, -1},
+    {0x66, 0x79, -1},
+    {0x6B, 0x61, -1},
+    {0x6B, 0x65, -1},
+    {0x6B, 0x6F, -1},
+    {0x6B, 0x75, -1},
+    {0x6B, 0x79, -1},
+    {0x6F, 0x2D, 1},
+    {0x6F, 0x2E, -1},
+    {0x6F, 0x78, -1},
+    {0x72, 0x2D, -2},
+    {0x72, 0x2E, -3},
+    {0x72, 0x3A, -1},
+    {0x72, 0x63, -1},
+    {0x72, 0x64, -1},
+    {0x72, 0x65, -1},
+    {0x72, 0x67, -1},
+    {0x72, 0x68, -1},
+    {0x72, 0x6D, -1},
+    {0x72, 0x6E, -1},
+    {0x72, 0x6F, -1},
+    {0x72, 0x71, -1},
+    {0x72, 0x72, -1},
+    {0x72, 0x78, -1},
+    {0x76, 0x2D, -1},
+    {0x76, 0x2E, -2},
+    {0x76, 0x3A, -2},
+    {0x77, 0x2E, -3},
+    {0x77, 0x3A, -2},
+    {0x78, 0x63, -1},
+    {0x78, 0x65, -1},
+    {0x78, 0x6F, -1},
+    {0x79, 0x2D, -1},
+    {0x79, 0x2E, -5},
+    {0x79, 0x3A, -2},
+};
+
+static constexpr BakedFont kBakedFonts[] = {
+    {32, {30, 8, 0, 38}, kBakedGlyphs32, kBakedKerning32, kBakedCoverage32},
+};
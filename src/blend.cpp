@@ -0,0 +1,233 @@
+#include <emmintrin.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "blend.h"
+
+// All modes work on 16-bit lanes, one per channel, and divide by 255 with round-to-nearest as
+// (t + (t >> 8)) >> 8, t = x + 128. Single pixels go through the same lane code as whole groups,
+// so a span gives the same result however it is split.
+
+static inline __m128i Div255(__m128i x) {
+    __m128i const t = _mm_adds_epu16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_adds_epu16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// Blends two pixels held as 16-bit lanes. `s` has its alpha lane forced to 255 unless the mode is
+// PremulSrcOver, `a` holds each pixel's alpha broadcast to all four of its lanes. Treating alpha
+// as a color channel of value 255 makes it come out as a + dstA * (1 - a).
+static inline __m128i BlendLanes(__m128i d, __m128i s, __m128i a, BlendMode mode) {
+    __m128i const inv = _mm_sub_epi16(_mm_set1_epi16(255), a);
+    switch (mode) {
+    case BlendMode::SrcOver:
+        return Div255(_mm_adds_epu16(_mm_mullo_epi16(d, inv), _mm_mullo_epi16(s, a)));
+    case BlendMode::PremulSrcOver:
+        return Div255(
+            _mm_adds_epu16(_mm_mullo_epi16(d, inv), _mm_mullo_epi16(s, _mm_set1_epi16(255))));
+    case BlendMode::Additive:
+        // min(d + x, 255) for 16-bit lanes that are known to hold bytes
+        return _mm_min_epi16(_mm_add_epi16(d, Div255(_mm_mullo_epi16(s, a))),
+                             _mm_set1_epi16(255));
+    case BlendMode::Multiply: {
+        __m128i const m = Div255(
+            _mm_adds_epu16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(_mm_set1_epi16(255), inv)));
+        return Div255(_mm_mullo_epi16(d, m));
+    }
+    case BlendMode::Replace:
+        break;
+    }
+    return s;
+}
+
+static inline __m128i BroadcastAlpha(__m128i lanes) {
+    lanes = _mm_shufflelo_epi16(lanes, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_shufflehi_epi16(lanes, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+uint32_t BlendPixel(uint32_t dst, uint32_t src, BlendMode mode) {
+    if (mode == BlendMode::Replace) {
+        return src;
+    }
+
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const s = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(src)), zero);
+    __m128i const d = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(dst)), zero);
+    // Forces the alpha lane of straight-alpha sources to 255, see BlendLanes
+    __m128i const alphaLane =
+        mode == BlendMode::PremulSrcOver ? zero : _mm_set_epi16(0, 0, 0, 0, 255, 0, 0, 0);
+    __m128i const result = BlendLanes(d, _mm_or_si128(s, alphaLane), BroadcastAlpha(s), mode);
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(result, result)));
+}
+
+void BlendSpan(uint32_t* dst, Color color, int count, BlendMode mode) {
+    if (mode == BlendMode::Replace) {
+        std::fill_n(dst, count, PackColor(color));
+        return;
+    }
+
+    uint32_t src = PackColor(color);
+    if (mode != BlendMode::PremulSrcOver) {
+        src |= 0xFF000000u;
+    }
+
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const s = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(src)), zero);
+    __m128i const a = _mm_set1_epi16(color.a);
+    for (; count >= 4; count -= 4, dst += 4) {
+        __m128i const d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+        __m128i const lo = BlendLanes(_mm_unpacklo_epi8(d, zero), s, a, mode);
+        __m128i const hi = BlendLanes(_mm_unpackhi_epi8(d, zero), s, a, mode);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(lo, hi));
+    }
+
+    uint32_t const packed = PackColor(color);
+    while (count-- > 0) {
+        *dst = BlendPixel(*dst, packed, mode);
+        dst++;
+    }
+}
+
+void BlendRow(uint32_t* dst, const uint32_t* src, int count, BlendMode mode) {
+    if (mode == BlendMode::Replace) {
+        memcpy(dst, src, size_t(count) * sizeof(uint32_t));
+        return;
+    }
+
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    // Forces the alpha lane of straight-alpha sources to 255, see BlendLanes
+    __m128i const alphaLane =
+        mode == BlendMode::PremulSrcOver ? zero : _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    bool const opaqueCopies = mode == BlendMode::SrcOver || mode == BlendMode::PremulSrcOver;
+    // Sources with alpha 0 leave the destination alone, premultiplied ones only if their color
+    // is 0 as well (otherwise they add it)
+    __m128i const transparentMask =
+        mode == BlendMode::PremulSrcOver ? _mm_set1_epi32(-1) : alphaMask;
+
+    for (; count >= 4; count -= 4, dst += 4, src += 4) {
+        __m128i const s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+        __m128i const alpha = _mm_and_si128(s, alphaMask);
+        if (opaqueCopies && _mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xFFFF) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), s);
+            continue;
+        }
+        __m128i const transparent = _mm_and_si128(s, transparentMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(transparent, zero)) == 0xFFFF) {
+            continue;
+        }
+
+        __m128i const d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+        __m128i const sLo = _mm_unpacklo_epi8(s, zero);
+        __m128i const sHi = _mm_unpackhi_epi8(s, zero);
+        __m128i const lo = BlendLanes(_mm_unpacklo_epi8(d, zero), _mm_or_si128(sLo, alphaLane),
+                                      BroadcastAlpha(sLo), mode);
+        __m128i const hi = BlendLanes(_mm_unpackhi_epi8(d, zero), _mm_or_si128(sHi, alphaLane),
+                                      BroadcastAlpha(sHi), mode);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(lo, hi));
+    }
+
+    while (count-- > 0) {
+        *dst = BlendPixel(*dst, *src++, mode);
+        dst++;
+    }
+}
+
+// What BlendMaskSpan needs for every pixel, as 16-bit lanes for two pixels
+struct MaskBlend {
+    __m128i color;      // alpha lane forced to 255 unless premultiplied
+    __m128i alpha;      // of the color before coverage
+    __m128i background; // straight, with its own alpha
+    bool hasBackground;
+    BlendMode mode;
+};
+
+// `d` holds two destination pixels and `c` their coverage broadcast to each pixel's lanes
+static inline __m128i MaskLanes(__m128i d, __m128i c, const MaskBlend& blend) {
+    __m128i const a = Div255(_mm_mullo_epi16(blend.alpha, c));
+    __m128i result;
+    if (blend.hasBackground) {
+        // Straight color over the background, then drawn like any other straight source
+        __m128i const inv = _mm_sub_epi16(_mm_set1_epi16(255), a);
+        __m128i const src = Div255(_mm_adds_epu16(_mm_mullo_epi16(blend.background, inv),
+                                                  _mm_mullo_epi16(blend.color, a)));
+        __m128i const forced = _mm_or_si128(src, _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0));
+        result = BlendLanes(d, forced, BroadcastAlpha(src), blend.mode);
+    } else if (blend.mode == BlendMode::PremulSrcOver) {
+        result = BlendLanes(d, Div255(_mm_mullo_epi16(blend.color, c)), a, blend.mode);
+    } else {
+        result = BlendLanes(d, blend.color, a, blend.mode);
+    }
+    // Untouched where there is no coverage, which for most modes the math gives anyway
+    __m128i const empty = _mm_cmpeq_epi16(c, _mm_setzero_si128());
+    return _mm_or_si128(_mm_and_si128(empty, d), _mm_andnot_si128(empty, result));
+}
+
+static inline uint32_t MaskPixel(uint32_t dst, uint8_t coverage, const MaskBlend& blend) {
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const d = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(dst)), zero);
+    __m128i const result = MaskLanes(d, _mm_set1_epi16(coverage), blend);
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(result, result)));
+}
+
+void BlendMaskSpan(uint32_t* dst, const uint8_t* coverage, int count, Color color,
+                   Color background, BlendMode mode) {
+    MaskBlend blend{};
+    blend.hasBackground = background.a != 0;
+    if (mode == BlendMode::Replace) {
+        // Coverage has to blend, so Replace becomes an opaque SrcOver
+        color.a = 255;
+        mode = BlendMode::SrcOver;
+    }
+    if (blend.hasBackground && mode == BlendMode::PremulSrcOver) {
+        // The color blended over the background is straight
+        mode = BlendMode::SrcOver;
+    }
+    blend.mode = mode;
+
+    uint32_t src = PackColor(color);
+    if (mode != BlendMode::PremulSrcOver || blend.hasBackground) {
+        src |= 0xFF000000u;
+    }
+    __m128i const zero = _mm_setzero_si128();
+    blend.color = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(src)), zero);
+    blend.alpha = _mm_set1_epi16(color.a);
+    blend.background =
+        _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(PackColor(background))), zero);
+
+    // Fully covered pixels often come out the same whatever was under them (an opaque color),
+    // whole groups of those are stored without blending
+    uint32_t const full = MaskPixel(0, 255, blend);
+    bool const fullIgnoresDst = MaskPixel(0xFFFFFFFFu, 255, blend) == full;
+    __m128i const fullGroup = _mm_set1_epi32(static_cast<int>(full));
+
+    for (; count >= 4; count -= 4, dst += 4, coverage += 4) {
+        uint32_t group;
+        memcpy(&group, coverage, sizeof(group));
+        if (group == 0) {
+            continue;
+        }
+        if (group == 0xFFFFFFFFu && fullIgnoresDst) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), fullGroup);
+            continue;
+        }
+
+        // Each pixel's coverage in all four of its lanes
+        __m128i c = _mm_cvtsi32_si128(static_cast<int>(group));
+        c = _mm_unpacklo_epi8(c, c);
+        c = _mm_unpacklo_epi16(c, c);
+        __m128i const d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+        __m128i const lo =
+            MaskLanes(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(c, zero), blend);
+        __m128i const hi =
+            MaskLanes(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(c, zero), blend);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(lo, hi));
+    }
+
+    for (; count > 0; count--, dst++, coverage++) {
+        if (*coverage != 0) {
+            *dst = MaskPixel(*dst, *coverage, blend);
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "color.h"
+
+// How a drawn pixel is combined with what is already in the frame buffer. `a` is the source
+// alpha; in every mode but PremulSrcOver the source color is straight (not premultiplied).
+enum class BlendMode : uint8_t {
+    Replace,       // dst = src, alpha ignored
+    SrcOver,       // dst = src * a + dst * (1 - a)
+    Additive,      // dst = dst + src * a
+    Multiply,      // dst = dst * (src * a + (1 - a))
+    PremulSrcOver, // dst = src + dst * (1 - a)
+};
+
+// True when drawing `color` with `mode` is a plain overwrite
+constexpr bool IsOpaqueBlend(Color const color, BlendMode const mode) {
+    return mode == BlendMode::Replace ||
+           (color.a == 255 && (mode == BlendMode::SrcOver || mode == BlendMode::PremulSrcOver));
+}
+
+// True when drawing `color` with `mode` leaves the destination unchanged
+constexpr bool IsNoOpBlend(Color const color, BlendMode const mode) {
+    return color.a == 0 && mode != BlendMode::Replace && mode != BlendMode::PremulSrcOver;
+}
+
+// Blends one source pixel (packed with PackColor) onto one destination pixel. Gives bit-identical
+// results to the span/row kernels below, so a span may be split at any point.
+uint32_t BlendPixel(uint32_t dst, uint32_t src, BlendMode mode);
+
+// Blends a single color onto `count` pixels, 4 per iteration
+void BlendSpan(uint32_t* dst, Color color, int count, BlendMode mode);
+
+// Blends `count` source pixels onto `dst`, each with its own alpha, 4 per iteration. Groups of
+// fully opaque or fully transparent source pixels are copied or skipped without blending.
+void BlendRow(uint32_t* dst, const uint32_t* src, int count, BlendMode mode);
+
+// Draws `color` onto `count` pixels with its alpha scaled by each pixel's coverage, 4 per
+// iteration. Pixels with coverage 0 are left alone. With a `background` whose alpha isn't 0, the
+// color is first blended over the background by coverage and the result drawn with `mode`;
+// otherwise it is blended with what is already there. Replace draws the color opaque, scaled by
+// coverage like SrcOver.
+void BlendMaskSpan(uint32_t* dst, const uint8_t* coverage, int count, Color color,
+                   Color background, BlendMode mode);
@@ -13,8 +13,9 @@ public:
 
     bool Update(); // fetch new frame (once per frame)
 
-    static void ConvertYUV422(const void* yuv_buf, int w, int h, Image& out);
-    static void ConvertRAW16(const void* raw16_buf, int w, int h, Image& out);
+    // Write a w x h frame into `out`, which must be that size; it may be part of a larger image
+    static void ConvertYUV422(const void* yuv_buf, int w, int h, ImageView out);
+    static void ConvertRAW16(const void* raw16_buf, int w, int h, ImageView out);
     bool RenderEyeToImage(int eye, int w, int h, Image& out);
 
     s32 handle{};
@@ -0,0 +1,96 @@
+#include <algorithm>
+
+#include "camera.h"
+
+// Frame format converters. They don't touch the camera device, so they also build for HOST_BUILD.
+
+static inline uint32_t YUVtoRGBA(uint8_t y, uint8_t u, uint8_t v) {
+    int c = (int)y - 16;
+    int d = (int)u - 128;
+    int e = (int)v - 128;
+
+    int r = (298 * c + 409 * e + 128) >> 8;
+    int g = (298 * c - 100 * d - 208 * e + 128) >> 8;
+    int b = (298 * c + 516 * d + 128) >> 8;
+
+    r = (r < 0) ? 0 : (r > 255 ? 255 : r);
+    g = (g < 0) ? 0 : (g > 255 ? 255 : g);
+    b = (b < 0) ? 0 : (b > 255 ? 255 : b);
+
+    return 0x80000000u | (r << 16) | (g << 8) | b;
+}
+
+void Camera::ConvertYUV422(const void* yuvBuffer, int w, int h, ImageView out) {
+    if (!out.pixels || out.width != w || out.height != h) {
+        // caller responsibility: preallocate correctly
+        return;
+    }
+
+    const uint8_t* src = static_cast<const uint8_t*>(yuvBuffer);
+    uint32_t* dst = out.pixels;
+    int stride = out.stride;
+
+    for (int y = 0; y < h; y++) {
+        uint32_t* row = dst + y * stride;
+        int srcRow = y * w * 2;
+
+        for (int x = 0; x < w; x += 2) {
+            int idx = srcRow + x * 2;
+
+            uint8_t y0 = src[idx + 0];
+            uint8_t u = src[idx + 1];
+            uint8_t y1 = src[idx + 2];
+            uint8_t v = src[idx + 3];
+
+            row[x + 0] = YUVtoRGBA(y0, u, v);
+            row[x + 1] = YUVtoRGBA(y1, u, v);
+        }
+    }
+}
+
+void Camera::ConvertRAW16(const void* raw16_buf, int w, int h, ImageView out) {
+    if (!out.pixels || out.width != w || out.height != h) {
+        return;
+    }
+
+    const uint16_t* src = static_cast<const uint16_t*>(raw16_buf);
+    uint32_t* dst = out.pixels;
+    int stride = out.stride;
+
+    constexpr uint16_t WHITE = 4095;
+
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            int idx = y * w + x;
+
+            bool evenRow = (y % 2) == 0;
+            bool evenCol = (x % 2) == 0;
+
+            uint16_t R = 0, G = 0, B = 0;
+
+            if (evenRow && evenCol) {
+                B = src[idx];
+                G = src[idx + 1];
+                R = src[idx + w + 1];
+            } else if (evenRow && !evenCol) {
+                G = src[idx];
+                B = src[idx - 1];
+                R = src[idx + w];
+            } else if (!evenRow && evenCol) {
+                G = src[idx];
+                R = src[idx + 1];
+                B = src[idx - w];
+            } else {
+                R = src[idx];
+                G = src[idx - 1];
+                B = src[idx - w - 1];
+            }
+
+            uint8_t r = std::min<uint16_t>(WHITE, R) >> 4;
+            uint8_t g = std::min<uint16_t>(WHITE, G) >> 4;
+            uint8_t b = std::min<uint16_t>(WHITE, B) >> 4;
+
+            dst[y * stride + x] = (0xFF << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+}
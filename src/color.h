@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+// Color is used to pack together RGBA information, and is used for every function that draws
+// colored pixels. Alpha defaults to opaque, so {r, g, b} still means a solid color.
+struct Color {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a = 255;
+};
+
+// Packs a Color into the A8R8G8B8 layout used by the frame buffers, for opaque writes.
+constexpr uint32_t EncodeColor(Color const color) {
+    return 0x80000000u | (uint32_t(color.r) << 16) | (uint32_t(color.g) << 8) | uint32_t(color.b);
+}
+
+// Packs a Color into A8R8G8B8 keeping its alpha, as the blend functions expect their source.
+constexpr uint32_t PackColor(Color const color) {
+    return (uint32_t(color.a) << 24) | (uint32_t(color.r) << 16) | (uint32_t(color.g) << 8) |
+           uint32_t(color.b);
+}
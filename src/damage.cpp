@@ -0,0 +1,42 @@
+#include "damage.h"
+
+void DamageList::Add(Rect rect) {
+    if (rect.Empty()) {
+        return;
+    }
+
+    // Fold the new rectangle into every existing one it can be merged with cheaply. A merge can
+    // make the result mergeable with rectangles that were checked earlier, so start over after
+    // each one.
+    for (size_t i = 0; i < rects.size();) {
+        const Rect& other = rects[i];
+        if (other.Contains(rect)) {
+            return;
+        }
+        Rect const merged = other.Union(rect);
+        if (merged.Area() <= other.Area() + rect.Area() + MergeSlack) {
+            rect = merged;
+            rects[i] = rects.back();
+            rects.pop_back();
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+
+    if (rects.size() == MaxRects) {
+        for (const Rect& other : rects) {
+            rect = rect.Union(other);
+        }
+        rects.clear();
+    }
+    rects.push_back(rect);
+}
+
+u64 DamageList::Area() const {
+    u64 area = 0;
+    for (const Rect& rect : rects) {
+        area += rect.Area();
+    }
+    return area;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "rect.h"
+
+// DamageList collects the regions of a frame buffer that have been drawn to. Rectangles that touch
+// or nearly touch are merged as they come in, and past MaxRects the whole list collapses into its
+// bounding box, so the list stays short no matter how many draws feed it.
+class DamageList {
+public:
+    static constexpr size_t MaxRects = 16;
+    // Merging may cover up to this many pixels that weren't actually drawn
+    static constexpr u64 MergeSlack = 256;
+
+    void Add(Rect rect);
+    void Reset() {
+        rects.clear();
+    }
+
+    const std::vector<Rect>& Rects() const {
+        return rects;
+    }
+    bool Empty() const {
+        return rects.empty();
+    }
+    u64 Area() const;
+
+private:
+    std::vector<Rect> rects;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include "types.h"
+
+// DisplayBackend is the platform half of Scene2D: it provides the memory the frame buffers live in
+// and presents finished frames. Scene2D itself only ever touches pixels.
+class DisplayBackend {
+public:
+    virtual ~DisplayBackend() = default;
+
+    virtual bool Open() = 0;
+
+    virtual void* AllocateVideoMem(size_t size, int alignment) = 0;
+    virtual void DeallocateVideoMem() = 0;
+
+    // SubmitFlip index that shows a blank screen instead of a buffer
+    static constexpr int BlankBuffer = -1;
+
+    virtual bool RegisterBuffers(char** buffers, int num, int width, int height) = 0;
+    // Forgets the registered buffers, so others can be registered. None of them may be on screen
+    // or queued for flip: flip to BlankBuffer and wait for it first.
+    virtual void UnregisterBuffers() = 0;
+
+    // Queues buffer `index` for display, tagged with `flipArg`. Returns false if the flip was not
+    // queued, in which case nothing is shown and `flipArg` is never displayed.
+    virtual bool SubmitFlip(int index, s64 flipArg) = 0;
+    // Blocks until the flip tagged with `flipArg`, or a later one, has been displayed. Flips are
+    // tagged with increasing values.
+    virtual void WaitFlip(s64 flipArg) = 0;
+};
+
+// Creates the backend of the platform this binary is built for (VideoOut on the console, plain
+// host memory for HOST_BUILD).
+DisplayBackend* CreateDisplayBackend();
@@ -0,0 +1,274 @@
+#include <string.h>
+
+#include <algorithm>
+
+#include "display_list.h"
+#include "image.h"
+#include "text.h"
+
+static constexpr size_t AlignCommand(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// The payload directly follows its header
+static constexpr size_t kPayloadOffset = AlignCommand(sizeof(DisplayList::CommandHeader));
+
+template <typename T>
+T* DisplayList::append(CommandType type, Rect bounds, size_t extra) {
+    static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= 8);
+
+    size_t const offset = arena.size();
+    size_t const size = AlignCommand(kPayloadOffset + sizeof(T) + extra);
+    arena.resize(offset + size);
+
+    uint8_t* command = arena.data() + offset;
+    new (command) CommandHeader{type, static_cast<uint32_t>(size), sortKey, bounds};
+    count++;
+    damage.Add(bounds);
+    return new (command + kPayloadOffset) T{};
+}
+
+void DisplayList::Clear() {
+    arena.clear();
+    count = 0;
+    sortKey = 0;
+    damage.Reset();
+}
+
+void DisplayList::Sort() {
+    // (key, offset) in recording order; nothing to move if the keys already never decrease
+    std::vector<std::pair<uint32_t, uint32_t>> order;
+    order.reserve(count);
+    bool sorted = true;
+    ForEach([&](uint32_t offset, const CommandHeader& header) {
+        sorted = sorted && (order.empty() || order.back().first <= header.key);
+        order.push_back({header.key, offset});
+    });
+    if (sorted) {
+        return;
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<uint8_t> reordered;
+    reordered.reserve(arena.size());
+    for (auto const& [key, offset] : order) {
+        const uint8_t* command = arena.data() + offset;
+        reordered.insert(reordered.end(), command,
+                         command + reinterpret_cast<const CommandHeader*>(command)->size);
+    }
+    arena.swap(reordered);
+}
+
+void DisplayList::FillRect(Rect rect, Color color, BlendMode blend) {
+    if (rect.Empty() || IsNoOpBlend(color, blend)) {
+        return;
+    }
+    *append<FillCommand>(CommandType::Fill, rect) = {rect, color, blend};
+}
+
+void DisplayList::DrawLine(int p1x, int p1y, int dx, int dy, int w, Color color,
+                           BlendMode blend, bool antialias) {
+    if (IsNoOpBlend(color, blend)) {
+        return;
+    }
+    *append<LineCommand>(CommandType::Line, LineBounds(p1x, p1y, dx, dy, w, antialias)) = {
+        p1x, p1y, dx, dy, w, color, blend, antialias};
+}
+
+void DisplayList::DrawPolyline(std::span<const Point> points, StrokeStyle const& style,
+                               Color color, BlendMode blend) {
+    if (points.empty() || IsNoOpBlend(color, blend)) {
+        return;
+    }
+
+    Rect const bounds = StrokeBounds(points.data(), int(points.size()), style);
+    auto* polyline =
+        append<PolylineCommand>(CommandType::Polyline, bounds, points.size_bytes());
+    *polyline = {int(points.size()), style, color, blend};
+    // The points follow the command in the payload
+    auto* const payloadPoints = reinterpret_cast<Point*>(reinterpret_cast<uint8_t*>(polyline) +
+                                                         sizeof(PolylineCommand));
+    memcpy(payloadPoints, points.data(), points.size_bytes());
+}
+
+void DisplayList::DrawEllipse(int cx, int cy, int rx, int ry, int thickness, Color color,
+                              BlendMode blend, bool antialias) {
+    if (rx < 0 || ry < 0 || IsNoOpBlend(color, blend)) {
+        return;
+    }
+    *append<EllipseCommand>(CommandType::Ellipse, EllipseBounds(cx, cy, rx, ry)) = {
+        cx, cy, rx, ry, thickness, color, blend, antialias};
+}
+
+void DisplayList::DrawArc(int cx, int cy, int radius, int thickness, float startDegrees,
+                          float sweepDegrees, Color color, BlendMode blend, bool antialias) {
+    if (radius < 0 || sweepDegrees == 0 || IsNoOpBlend(color, blend)) {
+        return;
+    }
+    Rect const bounds = ArcBounds(cx, cy, radius, thickness, startDegrees, sweepDegrees);
+    *append<ArcCommand>(CommandType::Arc, bounds) = {
+        cx, cy, radius, thickness, startDegrees, sweepDegrees, color, blend, antialias};
+}
+
+void DisplayList::DrawRoundedRect(Rect rect, int radius, int thickness, Color color,
+                                  BlendMode blend, bool antialias) {
+    if (rect.Empty() || IsNoOpBlend(color, blend)) {
+        return;
+    }
+    *append<RoundedRectCommand>(CommandType::RoundedRect, RoundedRectBounds(rect)) = {
+        rect, radius, thickness, color, blend, antialias};
+}
+
+void DisplayList::DrawGlyph(const uint8_t* coverage, int w, int h, int pitch, int x, int y,
+                            Color color, Color background, BlendMode blend) {
+    Rect const bounds = Rect::FromSize(x, y, w, h);
+    if (bounds.Empty() || (background.a == 0 && IsNoOpBlend(color, blend))) {
+        return;
+    }
+
+    // Keep a tightly packed copy, the caller's bitmap is usually FreeType's reused glyph slot
+    auto* glyph = append<GlyphCommand>(CommandType::Glyph, bounds, size_t(w) * h);
+    *glyph = {x, y, w, h, color, background, blend};
+    auto* dst = reinterpret_cast<uint8_t*>(glyph + 1);
+    for (int row = 0; row < h; row++) {
+        memcpy(dst + size_t(row) * w, coverage + row * pitch, w);
+    }
+}
+
+void DisplayList::DrawText(std::string_view txt, FT_Face face, int startX, int startY,
+                           Color bgColor, Color fgColor, BlendMode blend) {
+    RenderGlyphs(txt, face, startX, startY, [&](const CachedGlyph& glyph, int x, int y) {
+        DrawGlyph(glyph.coverage, glyph.width, glyph.height, glyph.pitch, x, y, fgColor, bgColor,
+                  blend);
+    });
+}
+
+void DisplayList::DrawText(std::span<const char32_t> codepoints, FT_Face face, int startX,
+                           int startY, Color bgColor, Color fgColor, BlendMode blend) {
+    RenderGlyphs(codepoints, face, startX, startY, [&](const CachedGlyph& glyph, int x, int y) {
+        DrawGlyph(glyph.coverage, glyph.width, glyph.height, glyph.pitch, x, y, fgColor, bgColor,
+                  blend);
+    });
+}
+
+void DisplayList::DrawTextLayout(const TextLayout& layout, int x, int y, Color bgColor,
+                                 Color fgColor, BlendMode blend) {
+    if (layout.Bounds().Empty() || (bgColor.a == 0 && IsNoOpBlend(fgColor, blend))) {
+        return;
+    }
+    *append<TextCommand>(CommandType::Text, layout.Bounds().Translate(x, y)) = {
+        &layout, x, y, fgColor, bgColor, blend};
+}
+
+void DisplayList::DrawSdfGlyph(const SdfGlyph& glyph, float x, float y, float scale,
+                               const SdfTextStyle& style, bool shadow) {
+    if (glyph.width == 0) {
+        return;
+    }
+    Rect const bounds = SdfGlyphBounds(glyph, x, y, scale, style, shadow);
+    *append<SdfGlyphCommand>(CommandType::SdfGlyph, bounds) = {&glyph, x, y, scale, shadow, style};
+}
+
+void DisplayList::DrawBitmap(const uint32_t* pixels, int w, int h, int stride, int x, int y,
+                             BlendMode blend) {
+    Rect const bounds = Rect::FromSize(x, y, w, h);
+    if (bounds.Empty()) {
+        return;
+    }
+    *append<BlitCommand>(CommandType::Blit, bounds) = {pixels, w, h, stride, x, y, blend};
+}
+
+void DisplayList::DrawImage(ImageView img, int x, int y, BlendMode blend) {
+    DrawBitmap(img.pixels, img.width, img.height, img.stride, x, y, blend);
+}
+
+void DisplayList::DrawBitmapScaled(const uint32_t* pixels, int stride, Rect srcRect,
+                                   Rect dstRect, ImageFilter filter, BlendMode blend) {
+    if (srcRect.Empty() || dstRect.Empty()) {
+        return;
+    }
+    *append<ScaledBlitCommand>(CommandType::ScaledBlit, dstRect) = {
+        pixels, stride, srcRect, dstRect, filter, blend};
+}
+
+void DisplayList::Execute(uint32_t offset, const RasterTarget& target) const {
+    const uint8_t* command = arena.data() + offset;
+    const auto& header = *reinterpret_cast<const CommandHeader*>(command);
+    const uint8_t* payload = command + kPayloadOffset;
+
+    switch (header.type) {
+    case CommandType::Fill: {
+        const auto& fill = *reinterpret_cast<const FillCommand*>(payload);
+        RasterFillRect(target, fill.rect, fill.color, fill.blend);
+        break;
+    }
+    case CommandType::Line: {
+        const auto& line = *reinterpret_cast<const LineCommand*>(payload);
+        RasterLine(target, line.x, line.y, line.dx, line.dy, line.w, line.color, line.blend,
+                   line.antialias);
+        break;
+    }
+    case CommandType::Polyline: {
+        const auto& polyline = *reinterpret_cast<const PolylineCommand*>(payload);
+        auto const* const points =
+            reinterpret_cast<const Point*>(payload + sizeof(PolylineCommand));
+        RasterStroke(target, points, polyline.count, polyline.style, polyline.color,
+                     polyline.blend);
+        break;
+    }
+    case CommandType::Ellipse: {
+        const auto& ellipse = *reinterpret_cast<const EllipseCommand*>(payload);
+        RasterEllipse(target, ellipse.cx, ellipse.cy, ellipse.rx, ellipse.ry, ellipse.thickness,
+                      ellipse.color, ellipse.blend, ellipse.antialias);
+        break;
+    }
+    case CommandType::Arc: {
+        const auto& arc = *reinterpret_cast<const ArcCommand*>(payload);
+        RasterArc(target, arc.cx, arc.cy, arc.radius, arc.thickness, arc.startDegrees,
+                  arc.sweepDegrees, arc.color, arc.blend, arc.antialias);
+        break;
+    }
+    case CommandType::RoundedRect: {
+        const auto& rounded = *reinterpret_cast<const RoundedRectCommand*>(payload);
+        RasterRoundedRect(target, rounded.rect, rounded.radius, rounded.thickness, rounded.color,
+                          rounded.blend, rounded.antialias);
+        break;
+    }
+    case CommandType::Glyph: {
+        const auto& glyph = *reinterpret_cast<const GlyphCommand*>(payload);
+        RasterGlyph(target, reinterpret_cast<const uint8_t*>(&glyph + 1), glyph.w, glyph.h,
+                    glyph.w, glyph.x, glyph.y, glyph.color, glyph.background, glyph.blend);
+        break;
+    }
+    case CommandType::Text: {
+        const auto& text = *reinterpret_cast<const TextCommand*>(payload);
+        text.layout->Raster(target, text.x, text.y, text.color, text.background, text.blend);
+        break;
+    }
+    case CommandType::SdfGlyph: {
+        const auto& sdf = *reinterpret_cast<const SdfGlyphCommand*>(payload);
+        RasterSdfGlyph(target, *sdf.glyph, sdf.x, sdf.y, sdf.scale, sdf.style, sdf.shadow);
+        break;
+    }
+    case CommandType::Blit: {
+        const auto& blit = *reinterpret_cast<const BlitCommand*>(payload);
+        RasterBlit(target, blit.src, blit.w, blit.h, blit.stride, blit.x, blit.y, blit.blend);
+        break;
+    }
+    case CommandType::ScaledBlit: {
+        const auto& blit = *reinterpret_cast<const ScaledBlitCommand*>(payload);
+        RasterScaledBlit(target, blit.src, blit.stride, blit.srcRect, blit.dstRect, blit.filter,
+                         blit.blend);
+        break;
+    }
+    }
+}
+
+void DisplayList::Execute(const RasterTarget& target) const {
+    ForEach([&](uint32_t offset, const CommandHeader& header) {
+        if (!header.bounds.Intersect(target.clip).Empty()) {
+            Execute(offset, target);
+        }
+    });
+}
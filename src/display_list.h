@@ -0,0 +1,208 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <new>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <proto-include.h>
+
+#include "color.h"
+#include "damage.h"
+#include "image.h"
+#include "image_scale.h"
+#include "raster.h"
+#include "sdf_text.h"
+#include "shapes.h"
+#include "stroke.h"
+#include "text_layout.h"
+
+// DisplayList records draw commands instead of executing them. Commands are plain structs packed
+// one after another into a linear arena, each behind a small header with its type, size and screen
+// bounds, so recording is a bump allocation and replaying a linear walk.
+//
+// Text is rasterized while recording and its coverage kept in the list, so a list can be replayed
+// any number of times (e.g. every frame for a static screen) without touching FreeType. Bitmaps
+// and text layouts are referenced, not copied: they must outlive the list, as must the distance
+// fields of SDF glyphs in their cache. Clear() keeps the arena's memory for the next recording.
+//
+// Commands replay in recording order. To group them differently, e.g. by layer, or all blits
+// of one image together, set a sort key before recording and call Sort() once recording is done.
+// Commands that overlap should only be given different keys if their order doesn't matter.
+//
+// A list is not thread-safe, but separate lists can be recorded on separate threads.
+class DisplayList {
+public:
+    enum class CommandType : uint8_t {
+        Fill,
+        Line,
+        Glyph,
+        Blit,
+        Polyline,
+        Ellipse,
+        Arc,
+        RoundedRect,
+        Text,
+        SdfGlyph,
+        ScaledBlit,
+    };
+
+    struct CommandHeader {
+        CommandType type;
+        uint32_t size; // of the whole command including this header, a multiple of 8
+        uint32_t key;  // sort key set when the command was recorded
+        Rect bounds;   // everything the command may write
+    };
+
+    struct FillCommand {
+        Rect rect;
+        Color color;
+        BlendMode blend;
+    };
+    struct LineCommand {
+        int x, y, dx, dy, w;
+        Color color;
+        BlendMode blend;
+        bool antialias;
+    };
+    // Followed by w * h bytes of coverage
+    struct GlyphCommand {
+        int x, y, w, h;
+        Color color;
+        Color background;
+        BlendMode blend;
+    };
+    struct TextCommand {
+        const TextLayout* layout;
+        int x, y;
+        Color color;
+        Color background;
+        BlendMode blend;
+    };
+    struct SdfGlyphCommand {
+        const SdfGlyph* glyph;
+        float x, y, scale;
+        bool shadow;
+        SdfTextStyle style;
+    };
+    struct BlitCommand {
+        const uint32_t* src;
+        int w, h, stride, x, y;
+        BlendMode blend;
+    };
+    struct ScaledBlitCommand {
+        const uint32_t* src;
+        int stride;
+        Rect srcRect, dstRect;
+        ImageFilter filter;
+        BlendMode blend;
+    };
+    // Followed by `count` points
+    struct PolylineCommand {
+        int count;
+        StrokeStyle style;
+        Color color;
+        BlendMode blend;
+    };
+    struct EllipseCommand {
+        int cx, cy, rx, ry, thickness;
+        Color color;
+        BlendMode blend;
+        bool antialias;
+    };
+    struct ArcCommand {
+        int cx, cy, radius, thickness;
+        float startDegrees, sweepDegrees;
+        Color color;
+        BlendMode blend;
+        bool antialias;
+    };
+    struct RoundedRectCommand {
+        Rect rect;
+        int radius, thickness;
+        Color color;
+        BlendMode blend;
+        bool antialias;
+    };
+
+    void Clear();
+
+    // Commands recorded from now on get `key`, 0 after Clear()
+    void SetSortKey(uint32_t key) {
+        sortKey = key;
+    }
+    // Stable-sorts the commands by key, so equal keys keep their recording order. This moves the
+    // commands in the arena, so don't sort a list that was submitted and isn't drawn yet.
+    void Sort();
+
+    bool Empty() const {
+        return arena.empty();
+    }
+    size_t CommandCount() const {
+        return count;
+    }
+    size_t SizeBytes() const {
+        return arena.size();
+    }
+    // The screen regions the recorded commands touch
+    const DamageList& Damage() const {
+        return damage;
+    }
+
+    void FillRect(Rect rect, Color color, BlendMode blend = BlendMode::SrcOver);
+    void DrawLine(int p1x, int p1y, int dx, int dy, int w, Color color,
+                  BlendMode blend = BlendMode::SrcOver, bool antialias = false);
+    void DrawPolyline(std::span<const Point> points, StrokeStyle const& style, Color color,
+                      BlendMode blend = BlendMode::SrcOver);
+    void DrawEllipse(int cx, int cy, int rx, int ry, int thickness, Color color,
+                     BlendMode blend = BlendMode::SrcOver, bool antialias = false);
+    void DrawArc(int cx, int cy, int radius, int thickness, float startDegrees,
+                 float sweepDegrees, Color color, BlendMode blend = BlendMode::SrcOver,
+                 bool antialias = false);
+    void DrawRoundedRect(Rect rect, int radius, int thickness, Color color,
+                         BlendMode blend = BlendMode::SrcOver, bool antialias = false);
+    void DrawGlyph(const uint8_t* coverage, int w, int h, int pitch, int x, int y, Color color,
+                   Color background, BlendMode blend = BlendMode::SrcOver);
+    // `txt` is UTF-8
+    void DrawText(std::string_view txt, FT_Face face, int startX, int startY, Color bgColor,
+                  Color fgColor, BlendMode blend = BlendMode::SrcOver);
+    void DrawText(std::span<const char32_t> codepoints, FT_Face face, int startX, int startY,
+                  Color bgColor, Color fgColor, BlendMode blend = BlendMode::SrcOver);
+    // The layout is referenced, not copied, and must outlive the list
+    void DrawTextLayout(const TextLayout& layout, int x, int y, Color bgColor, Color fgColor,
+                        BlendMode blend = BlendMode::SrcOver);
+    // The field is referenced from SdfGlyphCache, see RasterSdfGlyph
+    void DrawSdfGlyph(const SdfGlyph& glyph, float x, float y, float scale,
+                      const SdfTextStyle& style, bool shadow);
+    void DrawBitmap(const uint32_t* pixels, int w, int h, int stride, int x, int y,
+                    BlendMode blend = BlendMode::Replace);
+    void DrawImage(ImageView img, int x, int y, BlendMode blend = BlendMode::Replace);
+    void DrawBitmapScaled(const uint32_t* pixels, int stride, Rect srcRect, Rect dstRect,
+                          ImageFilter filter, BlendMode blend = BlendMode::Replace);
+
+    // Calls fn(offset, header) for every command in recording order, starting at byte `offset`
+    template <typename Fn>
+    void ForEach(Fn&& fn, size_t offset = 0) const {
+        while (offset < arena.size()) {
+            const auto& header = *reinterpret_cast<const CommandHeader*>(arena.data() + offset);
+            fn(static_cast<uint32_t>(offset), header);
+            offset += header.size;
+        }
+    }
+
+    // Runs the command at `offset`, or all of them, against `target`
+    void Execute(uint32_t offset, const RasterTarget& target) const;
+    void Execute(const RasterTarget& target) const;
+
+private:
+    // Reserves a command with `extra` trailing bytes and returns its payload
+    template <typename T>
+    T* append(CommandType type, Rect bounds, size_t extra = 0);
+
+    std::vector<uint8_t> arena;
+    size_t count{};
+    uint32_t sortKey{};
+    DamageList damage;
+};
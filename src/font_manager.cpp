@@ -0,0 +1,113 @@
+#include <stdio.h>
+
+#include "font_manager.h"
+#include "glyph_cache.h"
+#include "logging.h"
+#include "sdf_text.h"
+
+FontManager::FontManager(FT_Library library) : library(library) {}
+
+FontManager::~FontManager() {
+    for (File& file : this->files) {
+        for (const Size& size : file.sizes) {
+            GlyphCache::Shared().Forget(size.face);
+            SdfGlyphCache::Shared().Forget(size.face);
+            FT_Done_Face(size.face);
+        }
+    }
+}
+
+int FontManager::Load(const char* path) {
+    for (size_t i = 0; i < this->files.size(); i++) {
+        if (this->files[i].path == path) {
+            return int(i);
+        }
+    }
+
+    FILE* stream = fopen(path, "rb");
+    if (!stream) {
+        LOG_ERROR("Failed to open font {}", path);
+        return -1;
+    }
+    fseek(stream, 0, SEEK_END);
+    long const size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+    if (size <= 0) {
+        LOG_ERROR("Failed to read font {}", path);
+        fclose(stream);
+        return -1;
+    }
+
+    // FreeType reads the faces straight from this buffer, it has to live as long as they do
+    File file{path, std::make_unique<FT_Byte[]>(size), size_t(size), {}, {}};
+    size_t const read = fread(file.data.get(), 1, file.size, stream);
+    fclose(stream);
+    if (read != file.size) {
+        LOG_ERROR("Failed to read font {}", path);
+        return -1;
+    }
+
+    this->files.push_back(std::move(file));
+    return int(this->files.size() - 1);
+}
+
+FT_Face FontManager::Get(int file, int pixelSize) {
+    if (file < 0 || size_t(file) >= this->files.size()) {
+        return nullptr;
+    }
+    for (const Size& size : this->files[file].sizes) {
+        if (size.pixelSize == pixelSize) {
+            return size.face;
+        }
+    }
+
+    FT_Face face;
+    File& entry = this->files[file];
+    if (FT_New_Memory_Face(this->library, entry.data.get(), FT_Long(entry.size), 0, &face) != 0) {
+        LOG_ERROR("Failed to open font {}", entry.path);
+        return nullptr;
+    }
+    if (FT_Set_Pixel_Sizes(face, 0, pixelSize) != 0) {
+        LOG_ERROR("Failed to set font {} to {}px", entry.path, pixelSize);
+        FT_Done_Face(face);
+        return nullptr;
+    }
+    entry.sizes.push_back({pixelSize, face});
+
+    // After registering the face, so fallback chains that loop back to this font find it
+    applyFallbacks(entry, pixelSize, face);
+    return face;
+}
+
+void FontManager::SetFallbacks(int file, std::vector<int> fallbacks) {
+    if (file < 0 || size_t(file) >= this->files.size()) {
+        return;
+    }
+    this->files[file].fallbacks = std::move(fallbacks);
+    // Get may open fallback sizes, which adds to `files[i].sizes` but never to `files`
+    for (size_t i = 0; i < this->files[file].sizes.size(); i++) {
+        Size const size = this->files[file].sizes[i];
+        applyFallbacks(this->files[file], size.pixelSize, size.face);
+    }
+}
+
+void FontManager::applyFallbacks(const File& file, int pixelSize, FT_Face face) {
+    std::vector<FT_Face> faces;
+    for (int const fallback : file.fallbacks) {
+        if (FT_Face const fallbackFace = Get(fallback, pixelSize)) {
+            faces.push_back(fallbackFace);
+        }
+    }
+    GlyphCache::Shared().SetFallbacks(face, std::move(faces));
+    SdfGlyphCache::Shared().Forget(face);
+}
+
+std::vector<FT_Face> FontManager::Faces() const {
+    std::vector<FT_Face> faces;
+    for (const File& file : this->files) {
+        for (const Size& size : file.sizes) {
+            faces.push_back(size.face);
+        }
+    }
+    return faces;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <proto-include.h>
+
+// FontManager reads each font file into memory once and opens a face from that memory for every
+// pixel size asked for, so sizes share the file data and never change each other's size: each is
+// a separate FT_Face, with its own glyphs in the glyph caches. The returned faces work with every
+// function that takes an FT_Face and stay open until the manager is destroyed.
+//
+// Not thread-safe; faces are normally requested while setting up a screen.
+class FontManager {
+public:
+    explicit FontManager(FT_Library library);
+    ~FontManager();
+
+    FontManager(const FontManager&) = delete;
+    FontManager& operator=(const FontManager&) = delete;
+
+    // Reads a font file, returning the id to request its sizes with, or -1 on failure. Loading
+    // the same path again returns the same id.
+    int Load(const char* path);
+
+    // The face of font `file` at `pixelSize`, opened on first request. Returns nullptr if the face
+    // can't be opened at that size.
+    FT_Face Get(int file, int pixelSize);
+
+    // Glyphs missing from `file` are taken from the first of `fallbacks` that has them, at the
+    // same pixel size. Applies to the sizes opened so far and the ones opened later. Text layouts
+    // cached before the change still show the missing glyphs.
+    void SetFallbacks(int file, std::vector<int> fallbacks);
+
+    // Every face opened so far
+    std::vector<FT_Face> Faces() const;
+
+private:
+    struct Size {
+        int pixelSize;
+        FT_Face face;
+    };
+    struct File {
+        std::string path;
+        std::unique_ptr<FT_Byte[]> data;
+        size_t size;
+        std::vector<int> fallbacks;
+        std::vector<Size> sizes;
+    };
+
+    void applyFallbacks(const File& file, int pixelSize, FT_Face face);
+
+    FT_Library library;
+    std::vector<File> files;
+};
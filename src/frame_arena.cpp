@@ -0,0 +1,117 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#include "frame_arena.h"
+
+// The buffer is cache line aligned, and grown in whole pages
+static constexpr size_t BufferAlignment = 64;
+static constexpr size_t GrowthGranularity = 4_KB;
+
+static uint8_t* AllocateBuffer(size_t capacity) {
+    return static_cast<uint8_t*>(::operator new(capacity, std::align_val_t(BufferAlignment)));
+}
+
+static void FreeBuffer(uint8_t* buffer) {
+    ::operator delete(buffer, std::align_val_t(BufferAlignment));
+}
+
+FrameArena::FrameArena(size_t capacity) : buffer(AllocateBuffer(capacity)), capacity(capacity) {}
+
+FrameArena::~FrameArena() {
+    Reset();
+    FreeBuffer(this->buffer);
+}
+
+void FrameArena::Reset() {
+    size_t const frameUsed = this->used + this->overflowBytes;
+    this->peak = std::max(this->peak, frameUsed);
+
+    if (this->overflow) {
+        // Each chunk was allocated with the alignment of the allocation it holds, which is
+        // what its header was padded to
+        while (Overflow* const chunk = this->overflow) {
+            this->overflow = chunk->next;
+            ::operator delete(chunk, std::align_val_t(chunk->alignment));
+        }
+        this->overflowBytes = 0;
+        this->overflows++;
+
+        // Alignment padding differs between the buffer and the chunks, leave some room for it
+        size_t const grown = frameUsed + frameUsed / 8;
+        FreeBuffer(this->buffer);
+        this->capacity = (grown + GrowthGranularity - 1) / GrowthGranularity * GrowthGranularity;
+        this->buffer = AllocateBuffer(this->capacity);
+    }
+    this->used = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    uintptr_t const next = reinterpret_cast<uintptr_t>(this->buffer) + this->used;
+    size_t const padding = (0 - next) & (alignment - 1);
+    if (padding + bytes <= this->capacity - this->used) {
+        this->used += padding + bytes;
+        return reinterpret_cast<void*>(next + padding);
+    }
+
+    size_t const chunkAlignment = std::max(alignment, alignof(Overflow));
+    size_t const header = (sizeof(Overflow) + chunkAlignment - 1) & ~(chunkAlignment - 1);
+    auto* const chunk = static_cast<Overflow*>(
+        ::operator new(header + bytes, std::align_val_t(chunkAlignment)));
+    chunk->next = this->overflow;
+    chunk->alignment = chunkAlignment;
+    this->overflow = chunk;
+    this->overflowBytes += header + bytes;
+    return reinterpret_cast<uint8_t*>(chunk) + header;
+}
+
+FrameArenaStats FrameArena::Stats() const {
+    return {this->capacity, this->used + this->overflowBytes,
+            std::max(this->peak, this->used + this->overflowBytes), this->overflows};
+}
+
+#ifdef _DEBUG
+// Replacements for the global allocation functions that count calls; the array and nothrow
+// forms forward to these.
+static std::atomic<u64> heapAllocations;
+
+u64 HeapAllocationCount() {
+    return heapAllocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* const memory = malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    size_t const align = static_cast<size_t>(alignment);
+    size_t const rounded = (std::max(size, size_t(1)) + align - 1) / align * align;
+    if (void* const memory = aligned_alloc(align, rounded)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    free(memory);
+}
+#endif
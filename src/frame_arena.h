@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory_resource>
+#include <string_view>
+
+#include "fmt/format.h"
+#include "types.h"
+
+struct FrameArenaStats {
+    size_t capacity; // of the buffer allocations are bumped from
+    size_t used;     // this frame, overflow included
+    size_t peak;     // the most any frame used
+    u64 overflows;   // frames that outgrew the buffer
+};
+
+// FrameArena is a bump allocator for memory that only lives until the end of a frame: formatted
+// strings, scratch buffers, containers built and thrown away while drawing. Allocating is a
+// pointer bump, deallocating does nothing, and Reset gives everything back at once.
+//
+// A frame that needs more than the buffer holds gets the rest from the heap; the next Reset frees
+// it and grows the buffer to what the frame used, so a steady state frame doesn't touch the heap.
+//
+// It is a std::pmr::memory_resource: std::pmr containers take it directly. Nothing allocated from
+// it may be used after Reset. Not thread safe, it belongs to the thread that draws the frame.
+class FrameArena final : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DefaultCapacity = 256_KB;
+
+    explicit FrameArena(size_t capacity = DefaultCapacity);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Frees everything allocated since the last Reset
+    void Reset();
+
+    template <typename T>
+    std::pmr::polymorphic_allocator<T> Allocator() {
+        return std::pmr::polymorphic_allocator<T>(this);
+    }
+
+    // Formats into the arena; the text, null terminated, lives until Reset
+    template <typename... Args>
+    std::string_view Format(fmt::format_string<Args...> format, Args&&... args) {
+        size_t const size = fmt::formatted_size(format, args...);
+        char* const text = static_cast<char*>(allocate(size + 1, 1));
+        *fmt::format_to_n(text, size, format, args...).out = '\0';
+        return {text, size};
+    }
+
+    FrameArenaStats Stats() const;
+
+private:
+    // Heap memory for allocations past the buffer, freed on Reset
+    struct Overflow {
+        Overflow* next;
+        size_t alignment;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    uint8_t* buffer{};
+    size_t capacity{};
+    size_t used{};
+    size_t overflowBytes{};
+    Overflow* overflow{};
+
+    size_t peak{};
+    u64 overflows{};
+};
+
+// fmt::memory_buffer whose contents spill from its inline storage into a FrameArena rather than
+// the heap: `FrameMemoryBuffer buffer{arena.Allocator<char>()};`
+using FrameMemoryBuffer =
+    fmt::basic_memory_buffer<char, fmt::inline_buffer_size, std::pmr::polymorphic_allocator<char>>;
+
+#ifdef _DEBUG
+// Allocations made through operator new so far, by every thread. Renderer uses it to count the
+// heap allocations each frame makes.
+u64 HeapAllocationCount();
+#endif
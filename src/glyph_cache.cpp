@@ -0,0 +1,270 @@
+#include <string.h>
+
+#include <algorithm>
+
+#include "assert.h"
+#include "glyph_cache.h"
+
+size_t GlyphCache::KeyHash::operator()(const Key& key) const {
+    u64 hash = reinterpret_cast<uintptr_t>(key.face);
+    hash = (hash ^ key.pixelSize) * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ key.codepoint) * 0x9E3779B97F4A7C15ull;
+    return size_t(hash ^ (hash >> 32));
+}
+
+GlyphCache& GlyphCache::Shared() {
+    static GlyphCache cache;
+    return cache;
+}
+
+GlyphCache::GlyphCache(size_t memoryLimit) : memoryLimit(memoryLimit) {}
+
+GlyphCache::Key GlyphCache::makeKey(FT_Face face, char32_t codepoint) const {
+    FT_Size_Metrics const& metrics = face->size->metrics;
+    return {face, u32(metrics.x_ppem) << 16 | metrics.y_ppem, codepoint};
+}
+
+const CachedGlyph& GlyphCache::Find(FT_Face face, char32_t codepoint) {
+    Key const key = makeKey(face, codepoint);
+
+    auto it = this->entries.find(key);
+    if (it != this->entries.end()) {
+        this->hits++;
+        if (it->second.page >= 0) {
+            this->pages[it->second.page].lastUse = ++this->useCounter;
+        }
+        return it->second.glyph;
+    }
+
+    this->misses++;
+    Entry const entry = rasterize(key);
+    if (entry.page >= 0) {
+        this->pages[entry.page].keys.push_back(key);
+    }
+    return this->entries.emplace(key, entry).first->second.glyph;
+}
+
+const GlyphMetrics& GlyphCache::FindMetrics(FT_Face face, char32_t codepoint) {
+    Key const key = makeKey(face, codepoint);
+
+    auto it = this->metrics.find(key);
+    if (it != this->metrics.end()) {
+        return it->second;
+    }
+
+    GlyphMetrics metrics{};
+    auto const rendered = this->entries.find(key);
+    if (rendered != this->entries.end()) {
+        const CachedGlyph& glyph = rendered->second.glyph;
+        metrics = {glyph.advance, glyph.index, glyph.valid};
+    } else {
+        // Hinted the same way as for rendering, so the advance matches Find's
+        FT_Face source = face;
+        FT_UInt const glyphIndex = resolve(source, codepoint);
+        if (FT_Load_Glyph(source, glyphIndex, FT_LOAD_DEFAULT) == 0) {
+            metrics = {int(source->glyph->advance.x >> 6), source == face ? glyphIndex : 0, true};
+        }
+    }
+    return this->metrics.emplace(key, metrics).first->second;
+}
+
+FT_UInt GlyphCache::resolve(FT_Face& face, char32_t codepoint) const {
+    FT_UInt const glyphIndex = FT_Get_Char_Index(face, codepoint);
+    if (glyphIndex != 0) {
+        return glyphIndex;
+    }
+    auto it = this->fallbacks.find(face);
+    if (it != this->fallbacks.end()) {
+        for (FT_Face const fallback : it->second) {
+            FT_UInt const fallbackIndex = FT_Get_Char_Index(fallback, codepoint);
+            if (fallbackIndex != 0) {
+                face = fallback;
+                return fallbackIndex;
+            }
+        }
+    }
+    return 0;
+}
+
+GlyphCache::Entry GlyphCache::rasterize(const Key& key) {
+    Entry entry{};
+    entry.page = -1;
+
+    FT_Face face = key.face;
+    FT_UInt const glyphIndex = resolve(face, key.codepoint);
+    if (FT_Load_Glyph(face, glyphIndex, FT_LOAD_DEFAULT) != 0 ||
+        FT_Render_Glyph(face->glyph, ft_render_mode_normal) != 0) {
+        return entry;
+    }
+
+    FT_GlyphSlot const slot = face->glyph;
+    FT_Bitmap const& bitmap = slot->bitmap;
+    CachedGlyph& glyph = entry.glyph;
+    glyph.width = int(bitmap.width);
+    glyph.height = int(bitmap.rows);
+    glyph.left = slot->bitmap_left;
+    glyph.top = slot->bitmap_top;
+    glyph.advance = int(slot->advance.x >> 6);
+    glyph.index = face == key.face ? glyphIndex : 0;
+    glyph.valid = true;
+    if (glyph.width == 0 || glyph.height == 0) {
+        return entry;
+    }
+
+    int x, y;
+    entry.page = allocate(glyph.width, glyph.height, x, y);
+    Page& page = this->pages[entry.page];
+    uint8_t* dst = page.pixels.get() + size_t(y) * page.width + x;
+    for (int row = 0; row < glyph.height; row++) {
+        memcpy(dst + size_t(row) * page.width, bitmap.buffer + row * bitmap.pitch, glyph.width);
+    }
+    page.lastUse = ++this->useCounter;
+    glyph.coverage = dst;
+    glyph.pitch = page.width;
+    return entry;
+}
+
+int GlyphCache::allocate(int w, int h, int& x, int& y) {
+    if (this->currentPage >= 0 && place(this->pages[this->currentPage], w, h, x, y)) {
+        return this->currentPage;
+    }
+
+    // Glyphs bigger than a page get a page of their own
+    int const width = std::max(w, PageSize);
+    int const height = std::max(h, PageSize);
+    size_t const bytes = size_t(width) * height;
+
+    int index;
+    if (this->pages.empty() || pageBytes() + bytes <= this->memoryLimit) {
+        index = int(this->pages.size());
+        this->pages.emplace_back();
+    } else {
+        index = leastRecentlyUsed();
+        evict(index);
+    }
+
+    Page& page = this->pages[index];
+    if (!page.pixels || page.width != width || page.height != height) {
+        page.pixels = std::make_unique<uint8_t[]>(bytes);
+        page.width = width;
+        page.height = height;
+    }
+    this->currentPage = index;
+
+    // An empty page is at least as big as the glyph
+    bool const placed = place(page, w, h, x, y);
+    ASSERT(placed);
+    return index;
+}
+
+bool GlyphCache::place(Page& page, int w, int h, int& x, int& y) {
+    if (page.shelfX + w > page.width) {
+        page.shelfY += page.shelfHeight;
+        page.shelfX = 0;
+        page.shelfHeight = 0;
+    }
+    if (w > page.width || page.shelfY + h > page.height) {
+        return false;
+    }
+    x = page.shelfX;
+    y = page.shelfY;
+    page.shelfX += w;
+    page.shelfHeight = std::max(page.shelfHeight, h);
+    return true;
+}
+
+void GlyphCache::evict(int index) {
+    Page& page = this->pages[index];
+    for (const Key& key : page.keys) {
+        this->entries.erase(key);
+    }
+    page.keys.clear();
+    page.shelfX = 0;
+    page.shelfY = 0;
+    page.shelfHeight = 0;
+    this->evictions++;
+}
+
+int GlyphCache::leastRecentlyUsed() const {
+    auto const oldest =
+        std::min_element(this->pages.begin(), this->pages.end(),
+                         [](const Page& a, const Page& b) { return a.lastUse < b.lastUse; });
+    return int(oldest - this->pages.begin());
+}
+
+size_t GlyphCache::pageBytes() const {
+    size_t bytes = 0;
+    for (const Page& page : this->pages) {
+        bytes += size_t(page.width) * page.height;
+    }
+    return bytes;
+}
+
+void GlyphCache::SetFallbacks(FT_Face face, std::vector<FT_Face> fallbacks) {
+    std::lock_guard lock{this->mutex};
+    // Glyphs that were missing may be found now
+    dropGlyphs(face);
+    this->fallbacks[face] = std::move(fallbacks);
+}
+
+FT_UInt GlyphCache::Resolve(FT_Face& face, char32_t codepoint) {
+    std::lock_guard lock{this->mutex};
+    return resolve(face, codepoint);
+}
+
+void GlyphCache::Forget(FT_Face face) {
+    std::lock_guard lock{this->mutex};
+    this->fallbacks.erase(face);
+    for (auto& [owner, chain] : this->fallbacks) {
+        std::erase(chain, face);
+    }
+    dropGlyphs(face);
+}
+
+void GlyphCache::dropGlyphs(FT_Face face) {
+    std::erase_if(this->entries, [face](const auto& item) { return item.first.face == face; });
+    std::erase_if(this->metrics, [face](const auto& item) { return item.first.face == face; });
+    for (Page& page : this->pages) {
+        std::erase_if(page.keys, [face](const Key& key) { return key.face == face; });
+    }
+}
+
+void GlyphCache::Clear() {
+    std::lock_guard lock{this->mutex};
+    this->entries.clear();
+    this->metrics.clear();
+    this->pages.clear();
+    this->currentPage = -1;
+}
+
+void GlyphCache::SetMemoryLimit(size_t bytes) {
+    std::lock_guard lock{this->mutex};
+    this->memoryLimit = bytes;
+
+    // Free the least recently used pages until the rest fits
+    while (this->pages.size() > 1 && pageBytes() > this->memoryLimit) {
+        int const index = leastRecentlyUsed();
+        evict(index);
+
+        // Entries refer to pages by index, so move the last page into the gap
+        int const last = int(this->pages.size()) - 1;
+        if (index != last) {
+            for (const Key& key : this->pages[last].keys) {
+                this->entries.find(key)->second.page = index;
+            }
+            this->pages[index] = std::move(this->pages[last]);
+        }
+        this->pages.pop_back();
+        if (this->currentPage == index) {
+            this->currentPage = -1;
+        } else if (this->currentPage == last) {
+            this->currentPage = index;
+        }
+    }
+}
+
+GlyphCacheStats GlyphCache::Stats() const {
+    std::lock_guard lock{this->mutex};
+    return {this->hits,         this->misses,      this->evictions,
+            this->entries.size(), this->pages.size(), pageBytes()};
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <proto-include.h>
+
+#include "types.h"
+
+// A glyph as FreeType rendered it. `coverage` points into an atlas page owned by the cache.
+struct CachedGlyph {
+    const uint8_t* coverage;
+    int pitch;
+    int width;
+    int height;
+    int left;    // from the pen position to the bitmap's left edge
+    int top;     // from the baseline up to the bitmap's top edge
+    int advance; // in whole pixels
+    u32 index;   // in the face, for kerning
+    bool valid;  // false if FreeType couldn't load or render it, such glyphs are skipped
+};
+
+// What laying a glyph out needs, without its bitmap
+struct GlyphMetrics {
+    int advance;
+    u32 index;
+    bool valid;
+};
+
+struct GlyphCacheStats {
+    u64 hits;
+    u64 misses;
+    u64 evictions; // pages
+    size_t glyphs;
+    size_t pages;
+    size_t bytes; // of atlas pages
+};
+
+// GlyphCache keeps glyphs rasterized by FreeType, keyed by face, pixel size and codepoint, so text
+// that was drawn before never goes through FreeType again. Coverage bitmaps are packed into
+// 8-bit atlas pages shelf by shelf. Once the pages reach the memory limit, the page used least
+// recently is emptied and reused, which drops every glyph on it.
+//
+// Find must be called with the lock from Lock() held, usually once around a whole string, and the
+// glyph it returns stays valid until the next Find, which may evict it. The other members take
+// the lock themselves.
+class GlyphCache {
+public:
+    static constexpr int PageSize = 512;
+    static constexpr size_t DefaultMemoryLimit = size_t(4) << 20;
+
+    // The cache text drawing goes through
+    static GlyphCache& Shared();
+
+    explicit GlyphCache(size_t memoryLimit = DefaultMemoryLimit);
+
+    GlyphCache(const GlyphCache&) = delete;
+    GlyphCache& operator=(const GlyphCache&) = delete;
+
+    std::unique_lock<std::mutex> Lock() {
+        return std::unique_lock{mutex};
+    }
+
+    // Looks up the glyph for `codepoint` at the face's current pixel size, rendering it on a miss
+    const CachedGlyph& Find(FT_Face face, char32_t codepoint);
+    // Same as Find, but only loads the glyph's metrics on a miss, without rendering it. Metrics are
+    // kept apart from the atlas and only dropped by Forget and Clear.
+    const GlyphMetrics& FindMetrics(FT_Face face, char32_t codepoint);
+
+    // Glyphs `face` doesn't have are taken from the first of `fallbacks` that has them, rendered
+    // at that face's own size. Glyphs from a fallback aren't kerned.
+    void SetFallbacks(FT_Face face, std::vector<FT_Face> fallbacks);
+    // The face among `face` and its fallbacks that has a glyph for `codepoint`, and the glyph's
+    // index in it. Leaves `face` alone and returns 0, the missing glyph, if none of them has one.
+    FT_UInt Resolve(FT_Face& face, char32_t codepoint);
+
+    // Drops everything cached for `face`, and the face from every fallback list. Must be called
+    // before the face is freed, a new face at the same address would otherwise find its glyphs.
+    void Forget(FT_Face face);
+    void Clear();
+
+    // Evicts pages right away if the cache is over the new limit. At least one page is always
+    // kept, however small the limit.
+    void SetMemoryLimit(size_t bytes);
+    GlyphCacheStats Stats() const;
+
+private:
+    struct Key {
+        FT_Face face;
+        u32 pixelSize; // x_ppem << 16 | y_ppem
+        char32_t codepoint;
+
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    struct Entry {
+        CachedGlyph glyph;
+        int page; // -1 for glyphs without pixels
+    };
+    struct Page {
+        std::unique_ptr<uint8_t[]> pixels;
+        int width;
+        int height;
+        // Glyphs are placed left to right on the current shelf, a new shelf starts below the
+        // tallest glyph once a row is full
+        int shelfX;
+        int shelfY;
+        int shelfHeight;
+        u64 lastUse;
+        std::vector<Key> keys;
+    };
+
+    Key makeKey(FT_Face face, char32_t codepoint) const;
+    FT_UInt resolve(FT_Face& face, char32_t codepoint) const;
+    Entry rasterize(const Key& key);
+    // Finds room for a w x h bitmap, evicting if needed, and returns its page
+    int allocate(int w, int h, int& x, int& y);
+    bool place(Page& page, int w, int h, int& x, int& y);
+    void evict(int page);
+    void dropGlyphs(FT_Face face);
+    int leastRecentlyUsed() const;
+    size_t pageBytes() const;
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    std::unordered_map<Key, GlyphMetrics, KeyHash> metrics;
+    std::unordered_map<FT_Face, std::vector<FT_Face>> fallbacks;
+    std::vector<Page> pages;
+    int currentPage{-1};
+    size_t memoryLimit;
+    u64 useCounter{};
+    u64 hits{};
+    u64 misses{};
+    u64 evictions{};
+};
@@ -3,17 +3,20 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
 #include <string>
 
 #include "graphics.h"
 #include "logging.h"
+#include "text.h"
 
-Scene2D::Scene2D(int w, int h, int pixelDepth)
-    : width(w), height(h), depth(pixelDepth),
+Scene2D::Scene2D(int w, int h, int pixelDepth, DisplayBackend* displayBackend)
+    : depth(pixelDepth), videoMem(nullptr),
+      backend(displayBackend ? displayBackend : CreateDisplayBackend()), frameBufferCount(0),
+      width(w), height(h), frameBuffers(nullptr), activeFrameBufferIdx(0),
       frameBufferSize(static_cast<size_t>(w) * static_cast<size_t>(h) *
                       static_cast<size_t>(pixelDepth)),
-      frameBuffers(nullptr), activeFrameBufferIdx(0), video(0), videoMem(nullptr), videoMemSP(0),
-      directMemOff(0), directMemAllocationSize(0) {}
+      frame_id(0) {}
 
 Scene2D::~Scene2D() {
     deallocateVideoMem();
@@ -23,18 +26,10 @@ Scene2D::~Scene2D() {
 }
 
 bool Scene2D::Init(size_t memSize, int numFrameBuffers) {
-    int rc;
-
-    this->video = sceVideoOutOpen(ORBIS_VIDEO_USER_MAIN, ORBIS_VIDEO_OUT_BUS_MAIN, 0, 0);
     this->videoMem = NULL;
 
-    if (this->video < 0) {
-        LOG_DEBUG("Failed to open a video out handle: {}", std::string(strerror(errno)));
-        return false;
-    }
-
-    if (!initFlipQueue()) {
-        LOG_DEBUG("Failed to initialize flip queue: {}", std::string(strerror(errno)));
+    if (!backend->Open()) {
+        LOG_DEBUG("Failed to open the display backend");
         return false;
     }
 
@@ -48,7 +43,6 @@ bool Scene2D::Init(size_t memSize, int numFrameBuffers) {
         return false;
     }
 
-    sceVideoOutSetFlipRate(this->video, 0);
     return true;
 }
 
@@ -69,138 +63,220 @@ int Scene2D::InitFontLib() {
     return ORBIS_OK;
 }
 
-bool Scene2D::initFlipQueue() {
-    int rc = sceKernelCreateEqueue(&flipQueue, "homebrew flip queue");
-
-    if (rc < 0)
+bool Scene2D::allocateFrameBuffers(int num) {
+    freeFrameBuffers();
+    if (num < 1 || num > MaxFrameBuffers) {
+        LOG_ERROR("Can't have {} frame buffers, 1 to {} are supported", num, MaxFrameBuffers);
         return false;
+    }
 
-    sceVideoOutAddFlipEvent(flipQueue, this->video, 0);
-    return true;
-}
-
-bool Scene2D::allocateFrameBuffers(int num) {
     // Allocate frame buffers array
     this->frameBuffers = new char*[num]{0};
+    this->frameBufferCount = num;
 
     // Set the display buffers
     for (int i = 0; i < num; i++) {
-        this->frameBuffers[i] = this->allocateDisplayMem(frameBufferSize);
+        this->frameBuffers[i] = this->allocateDisplayMem(frameBufferSize,
+                                                         VideoMemoryTag::FrameBuffer);
+        if (!this->frameBuffers[i]) {
+            freeFrameBuffers();
+            return false;
+        }
     }
 
-    // Set SRGB pixel format
-    sceVideoOutSetBufferAttribute(&this->attr, 0x80000000, 1, 0, this->width, this->height,
-                                  this->width);
-
-    // Register the buffers to the video handle
-    return (sceVideoOutRegisterBuffers(this->video, 0, (void**)this->frameBuffers, num,
-                                       &this->attr) == 0);
-}
+    this->queuedFlips.assign(num, -1);
 
-char* Scene2D::allocateDisplayMem(size_t size) {
-    // Essentially just bump allocation
-    char* allocatedPtr = (char*)videoMemSP;
-    videoMemSP += size;
+    // Nothing is known about the initial contents, the first clear of each buffer is a full one
+    this->damage.assign(num, DamageList{});
+    for (DamageList& list : this->damage) {
+        list.Add(ScreenRect());
+    }
+    this->stale.assign(num, DamageList{});
+    Invalidate(ScreenRect());
+    this->redrawRect = ScreenRect();
 
-    return allocatedPtr;
+    // Register the buffers with the display
+    return backend->RegisterBuffers(this->frameBuffers, num, this->width, this->height);
 }
 
-bool Scene2D::allocateVideoMem(size_t size, int alignment) {
-    int rc;
-
-    // Align the allocation size
-    this->directMemAllocationSize = (size + alignment - 1) / alignment * alignment;
-
-    // Allocate memory for display buffer
-    rc = sceKernelAllocateDirectMemory(0, sceKernelGetDirectMemorySize(),
-                                       this->directMemAllocationSize, alignment, 3,
-                                       &this->directMemOff);
-
-    if (rc < 0) {
-        this->directMemAllocationSize = 0;
-        return false;
+void Scene2D::freeFrameBuffers() {
+    // One of the buffers is on screen once any has been flipped to. Blank the screen and wait
+    // for that, so none is scanned out by the time its memory can be handed out again.
+    if (std::any_of(this->queuedFlips.begin(), this->queuedFlips.end(),
+                    [](s64 flip) { return flip >= 0; }) &&
+        backend->SubmitFlip(DisplayBackend::BlankBuffer, frame_id)) {
+        backend->WaitFlip(frame_id);
+        frame_id++;
     }
+    this->queuedFlips.clear();
 
-    // Map the direct memory
-    rc = sceKernelMapDirectMemory(&this->videoMem, this->directMemAllocationSize, 0x33, 0,
-                                  this->directMemOff, alignment);
+    if (this->frameBuffers) {
+        backend->UnregisterBuffers();
+        for (int i = 0; i < this->frameBufferCount; i++) {
+            freeDisplayMem(this->frameBuffers[i]);
+        }
+        // delete[] because it was new char*[]
+        delete[] this->frameBuffers;
+        this->frameBuffers = nullptr;
+    }
+    this->frameBufferCount = 0;
+    this->activeFrameBufferIdx = 0;
+}
 
-    if (rc < 0) {
-        sceKernelReleaseDirectMemory(this->directMemOff, this->directMemAllocationSize);
+char* Scene2D::allocateDisplayMem(size_t size, VideoMemoryTag tag, size_t alignment) {
+    return static_cast<char*>(this->videoMemory.Allocate(size, alignment, tag));
+}
 
-        this->directMemOff = 0;
-        this->directMemAllocationSize = 0;
+void Scene2D::freeDisplayMem(void* memory) {
+    this->videoMemory.Free(memory);
+}
 
+bool Scene2D::allocateVideoMem(size_t size, int alignment) {
+    this->videoMem = backend->AllocateVideoMem(size, alignment);
+    if (!this->videoMem) {
         return false;
     }
 
-    // Set the stack pointer to the beginning of the buffer
-    this->videoMemSP = (uintptr_t)this->videoMem;
+    this->videoMemory.Reset(this->videoMem, size);
     return true;
 }
 
 void Scene2D::deallocateVideoMem() {
-    // Free the direct memory
-    if (this->directMemOff)
-        sceKernelReleaseDirectMemory(this->directMemOff, this->directMemAllocationSize);
+    freeFrameBuffers();
+    backend->DeallocateVideoMem();
 
     // Zero out metadata
     this->videoMem = nullptr;
-    this->videoMemSP = 0;
-    this->directMemOff = 0;
-    this->directMemAllocationSize = 0;
-
-    // Free the frame buffer array (delete[] because it was new char*[])
-    if (this->frameBuffers) {
-        delete[] this->frameBuffers;
-        this->frameBuffers = nullptr;
-    }
-    this->activeFrameBufferIdx = 0;
+    this->videoMemory.Reset(nullptr, 0);
 }
 
 void Scene2D::SetActiveFrameBuffer(int index) {
+    foldPixelDamage();
     this->activeFrameBufferIdx = index;
 }
 
 void Scene2D::SubmitFlip() {
-    sceVideoOutSubmitFlip(this->video, this->activeFrameBufferIdx, ORBIS_VIDEO_OUT_FLIP_VSYNC,
-                          frame_id);
+    foldPixelDamage();
+    Flush();
+    // A buffer that failed to queue is not going on screen, and its flip arg is never shown:
+    // nothing may wait for either
+    if (!backend->SubmitFlip(this->activeFrameBufferIdx, frame_id)) {
+        this->queuedFlips[this->activeFrameBufferIdx] = -1;
+        return;
+    }
+    this->queuedFlips[this->activeFrameBufferIdx] = frame_id;
+    frame_id++;
 }
 
 void Scene2D::FrameWait() {
-    OrbisKernelEvent evt;
-    int count;
+    s64& queued = this->queuedFlips[nextFrameBuffer()];
+    if (queued < 0) {
+        return;
+    }
+    // The buffer leaves the screen once the flip after its own has been displayed. With a single
+    // buffer there is no such flip yet, its own is the best there is to wait for.
+    backend->WaitFlip(std::min(queued + 1, s64(frame_id - 1)));
+    queued = -1;
+}
 
-    // If the video handle is not initialized, bail out. This is mostly a failsafe, this should
-    // never happen.
-    if (this->video == 0)
+void Scene2D::FrameBufferSwap() {
+    foldPixelDamage();
+    this->activeFrameBufferIdx = nextFrameBuffer();
+}
+
+void Scene2D::FrameBufferClear() {
+    // The active buffer still holds the frame that was drawn into it the last time it was active
+    // (as many frames ago as there are buffers), on top of an already clear background. Restoring
+    // just the regions that frame touched is as good as a full clear.
+    foldPixelDamage();
+    DamageList& list = this->damage[this->activeFrameBufferIdx];
+    if (this->partialRedraw) {
+        // Only what changed is redrawn, on top of the frame the buffer already holds
+        DamageList& changed = this->stale[this->activeFrameBufferIdx];
+        this->redrawRect = {};
+        for (Rect const& rect : changed.Rects()) {
+            this->redrawRect = this->redrawRect.Empty() ? rect : this->redrawRect.Union(rect);
+        }
+        changed.Reset();
+        fillRect(this->redrawRect, this->clearColor, BlendMode::Replace);
+        // Not needed here, and SetPartialRedraw(false) marks the whole buffer dirty anyway
+        list.Reset();
         return;
+    }
+
+    this->redrawRect = ScreenRect();
+    for (Rect const& rect : list.Rects()) {
+        fillRect(rect, this->clearColor, BlendMode::Replace);
+    }
+    list.Reset();
+}
 
-    for (;;) {
-        OrbisVideoOutFlipStatus flipStatus;
+void Scene2D::SetTiledRendering(int numThreads) {
+    Flush();
+    if (numThreads > 0) {
+        this->tiles = std::make_unique<TileRenderer>(this->width, this->height, numThreads);
+    } else {
+        this->tiles.reset();
+    }
+}
 
-        // Get the flip status and check the arg for the given frame ID
-        sceVideoOutGetFlipStatus(video, &flipStatus);
+void Scene2D::Execute(const DisplayList& list) {
+    if (this->tiles) {
+        this->tiles->Submit(list);
+    } else {
+        list.Execute(screenTarget());
+    }
+    for (Rect const& rect : list.Damage().Rects()) {
+        MarkDirty(rect);
+    }
+}
 
-        if (flipStatus.flipArg == frame_id)
-            break;
+void Scene2D::Flush() {
+    if (this->tiles) {
+        this->tiles->Flush((uint32_t*)this->frameBuffers[this->activeFrameBufferIdx], this->width,
+                           this->redrawRect);
+    }
+    // Nothing recorded refers to the cached layouts anymore
+    this->textLayouts.Trim();
+}
 
-        // Wait on next flip event
-        if (sceKernelWaitEqueue(this->flipQueue, &evt, 1, &count, 0) != 0)
-            break;
+void Scene2D::SetClearColor(Color color) {
+    this->clearColor = color;
+    for (DamageList& list : this->damage) {
+        list.Add(ScreenRect());
     }
-    frame_id++;
+    Invalidate(ScreenRect());
 }
 
-void Scene2D::FrameBufferSwap() {
-    // Swap the frame buffer for some perf
-    this->activeFrameBufferIdx = 1 - this->activeFrameBufferIdx;
+void Scene2D::MarkDirty(Rect rect) {
+    this->damage[this->activeFrameBufferIdx].Add(rect.Intersect(ScreenRect()));
 }
 
-void Scene2D::FrameBufferClear() {
-    // Clear the screen with a uniform colour
-    Color blank = {50, 50, 50};
-    FrameBufferFill(blank);
+void Scene2D::foldPixelDamage() {
+    MarkDirty(this->pixelDamage);
+    this->pixelDamage = NoPixels;
+}
+
+void Scene2D::SetPartialRedraw(bool enabled) {
+    if (enabled == this->partialRedraw) {
+        return;
+    }
+    this->partialRedraw = enabled;
+    // Neither mode knows what the other left in the buffers
+    Invalidate(ScreenRect());
+    for (DamageList& list : this->damage) {
+        list.Add(ScreenRect());
+    }
+}
+
+void Scene2D::Invalidate(Rect rect) {
+    rect = rect.Intersect(ScreenRect());
+    if (rect.Empty()) {
+        return;
+    }
+    for (DamageList& list : this->stale) {
+        list.Add(rect);
+    }
 }
 
 bool Scene2D::InitFont(FT_Face* face, const char* fontPath, int fontSize) {
@@ -223,170 +299,251 @@ void Scene2D::FrameBufferFill(Color color) {
     DrawRectangle(0, 0, this->width, this->height, color);
 }
 
-void Scene2D::DrawPixel(int const x, int const y, Color const color) {
-    if (x < 0 || y < 0 || x > width || y > height) {
-        return;
-    }
-    int pixel = (y * this->width) + x;
-    uint32_t encodedColor = 0x80000000u | (color.r << 16) | (color.g << 8) | color.b;
-    ((uint32_t*)this->frameBuffers[this->activeFrameBufferIdx])[pixel] = encodedColor;
+RasterTarget Scene2D::screenTarget() const {
+    return {(uint32_t*)this->frameBuffers[this->activeFrameBufferIdx], this->width,
+            this->redrawRect};
 }
 
-void Scene2D::DrawRectangle(int const x, int const y, int const w, int const h, Color const color) {
-    int xPos, yPos;
-    if (x < 0 || y < 0 || x + w > width || y + h > height) {
-        return;
+void Scene2D::DrawPixel(int const x, int const y, Color const color, BlendMode const blend) {
+    Rect const rect = Rect::FromSize(x, y, 1, 1);
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) { list.FillRect(rect, color, blend); });
+    } else {
+        RasterPixel(screenTarget(), x, y, color, blend);
     }
 
-    // Draw row-by-row, column-by-column
-    for (yPos = y; yPos < y + h; yPos++) {
-        for (xPos = x; xPos < x + w; xPos++) {
-            DrawPixel(xPos, yPos, color);
-        }
+    // Only written when the box grows, which most pixels of a frame don't: a store on every call
+    // would chain each call to the previous one through memory
+    if (!this->pixelDamage.Contains(rect)) {
+        this->pixelDamage = this->pixelDamage.Union(rect);
     }
 }
 
-void Scene2D::DrawRectangleWithBorder(int const x, int const y, int const w, int const h,
-                                      Color const color, int const b_w, Color const b_color) {
-    int xPos, yPos;
-    // top
-    for (yPos = y; yPos < y + b_w; yPos++) {
-        for (xPos = x; xPos < x + w; xPos++) {
-            DrawPixel(xPos, yPos, b_color);
-        }
-    }
-    // bottom
-    for (yPos = y + h - b_w; yPos < y + h; yPos++) {
-        for (xPos = x; xPos < x + w; xPos++) {
-            DrawPixel(xPos, yPos, b_color);
-        }
-    }
-    // left
-    for (yPos = y + b_w; yPos < y + h - b_w; yPos++) {
-        for (xPos = x; xPos < x + b_w; xPos++) {
-            DrawPixel(xPos, yPos, b_color);
-        }
-    }
-    // right
-    for (yPos = y + b_w; yPos < y + h - b_w; yPos++) {
-        for (xPos = x + w - b_w; xPos < x + w; xPos++) {
-            DrawPixel(xPos, yPos, b_color);
-        }
-    }
-    // center
-    for (yPos = y + b_w; yPos < y + h - b_w; yPos++) {
-        for (xPos = x + b_w; xPos < x + w - b_w; xPos++) {
-            DrawPixel(xPos, yPos, color);
-        }
+void Scene2D::fillRect(Rect const& rect, Color const color, BlendMode const blend) {
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) { list.FillRect(rect, color, blend); });
+    } else {
+        RasterFillRect(screenTarget(), rect, color, blend);
     }
 }
 
-void Scene2D::DrawLine(int const p1x, int const p1y, int const dx, int const dy, int const w,
-                       Color const c) {
+void Scene2D::DrawRectangle(int const x, int const y, int const w, int const h, Color const color,
+                            BlendMode const blend) {
+    Rect const rect = Rect::FromSize(x, y, w, h);
+    fillRect(rect, color, blend);
+    MarkDirty(rect);
+}
 
-    int p2x = p1x + dx;
-    int p2y = p1y + dy;
-    int adx = abs(dx);
-    int ady = -abs(dy);
+void Scene2D::DrawRectangleWithBorder(int const x, int const y, int const w, int const h,
+                                      Color const color, int const b_w, Color const b_color,
+                                      BlendMode const blend) {
+    int const innerH = h - 2 * b_w;
+    // top and bottom
+    DrawRectangle(x, y, w, std::min(b_w, h), b_color, blend);
+    DrawRectangle(x, std::max(y + h - b_w, y + b_w), w, std::min(b_w, h - b_w), b_color, blend);
+    // left and right
+    DrawRectangle(x, y + b_w, b_w, innerH, b_color, blend);
+    DrawRectangle(x + w - b_w, y + b_w, b_w, innerH, b_color, blend);
+    // center
+    DrawRectangle(x + b_w, y + b_w, w - 2 * b_w, innerH, color, blend);
+}
 
-    int sx = dx >= 0 ? 1 : -1;
-    int sy = dy >= 0 ? 1 : -1;
+void Scene2D::DrawLine(int const p1x, int const p1y, int const dx, int const dy, int const w,
+                       Color const c, BlendMode const blend, bool const antialias) {
+    if (this->tiles) {
+        this->tiles->Record(
+            [&](DisplayList& list) { list.DrawLine(p1x, p1y, dx, dy, w, c, blend, antialias); });
+    } else {
+        RasterLine(screenTarget(), p1x, p1y, dx, dy, w, c, blend, antialias);
+    }
+    MarkDirty(LineBounds(p1x, p1y, dx, dy, w, antialias));
+}
 
-    int err = adx + ady;
+void Scene2D::DrawPolyline(std::span<const Point> points, StrokeStyle const& style, Color const c,
+                           BlendMode const blend) {
+    if (points.empty()) {
+        return;
+    }
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) { list.DrawPolyline(points, style, c, blend); });
+    } else {
+        RasterStroke(screenTarget(), points.data(), int(points.size()), style, c, blend);
+    }
+    MarkDirty(StrokeBounds(points.data(), int(points.size()), style));
+}
 
-    int x = p1x;
-    int y = p1y;
+void Scene2D::FillCircle(int const cx, int const cy, int const radius, Color const c,
+                         BlendMode const blend, bool const antialias) {
+    DrawEllipse(cx, cy, radius, radius, 0, c, blend, antialias);
+}
 
-    while (true) {
-        for (int oy = -w / 2; oy <= w / 2; ++oy) {
-            for (int ox = -w / 2; ox <= w / 2; ++ox) {
-                DrawPixel(x + ox, y + oy, c);
-            }
-        }
+void Scene2D::DrawCircle(int const cx, int const cy, int const radius, int const thickness,
+                         Color const c, BlendMode const blend, bool const antialias) {
+    DrawEllipse(cx, cy, radius, radius, thickness, c, blend, antialias);
+}
 
-        if (x == p2x && y == p2y)
-            break;
+void Scene2D::FillEllipse(int const cx, int const cy, int const rx, int const ry, Color const c,
+                          BlendMode const blend, bool const antialias) {
+    DrawEllipse(cx, cy, rx, ry, 0, c, blend, antialias);
+}
 
-        int e2 = 2 * err;
+void Scene2D::DrawEllipse(int const cx, int const cy, int const rx, int const ry,
+                          int const thickness, Color const c, BlendMode const blend,
+                          bool const antialias) {
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) {
+            list.DrawEllipse(cx, cy, rx, ry, thickness, c, blend, antialias);
+        });
+    } else {
+        RasterEllipse(screenTarget(), cx, cy, rx, ry, thickness, c, blend, antialias);
+    }
+    MarkDirty(EllipseBounds(cx, cy, rx, ry));
+}
 
-        if (e2 >= ady) {
-            err += ady;
-            x += sx;
-        }
-        if (e2 <= adx) {
-            err += adx;
-            y += sy;
-        }
+void Scene2D::DrawArc(int const cx, int const cy, int const radius, int const thickness,
+                      float const startDegrees, float const sweepDegrees, Color const c,
+                      BlendMode const blend, bool const antialias) {
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) {
+            list.DrawArc(cx, cy, radius, thickness, startDegrees, sweepDegrees, c, blend,
+                         antialias);
+        });
+    } else {
+        RasterArc(screenTarget(), cx, cy, radius, thickness, startDegrees, sweepDegrees, c, blend,
+                  antialias);
     }
+    MarkDirty(ArcBounds(cx, cy, radius, thickness, startDegrees, sweepDegrees));
 }
 
-void Scene2D::DrawText(char const* txt, FT_Face face, int startX, int startY, Color bgColor,
-                       Color fgColor) {
-    int rc;
-    int xOffset = 0;
-    int yOffset = 0;
+void Scene2D::FillRoundedRect(int const x, int const y, int const w, int const h,
+                              int const radius, Color const c, BlendMode const blend,
+                              bool const antialias) {
+    DrawRoundedRect(x, y, w, h, radius, 0, c, blend, antialias);
+}
 
-    // Get the glyph slot for bitmap and font metrics
-    FT_GlyphSlot slot = face->glyph;
+void Scene2D::DrawRoundedRect(int const x, int const y, int const w, int const h,
+                              int const radius, int const thickness, Color const c,
+                              BlendMode const blend, bool const antialias) {
+    Rect const rect = Rect::FromSize(x, y, w, h);
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) {
+            list.DrawRoundedRect(rect, radius, thickness, c, blend, antialias);
+        });
+    } else {
+        RasterRoundedRect(screenTarget(), rect, radius, thickness, c, blend, antialias);
+    }
+    MarkDirty(RoundedRectBounds(rect));
+}
 
-    // Iterate each character of the text to write to the screen
-    for (int n = 0; n < strlen(txt); n++) {
-        FT_UInt glyph_index;
+void Scene2D::DrawBitmap(const uint32_t* pixels, int const w, int const h, int const stride,
+                         int const x, int const y, BlendMode const blend) {
+    if (this->tiles) {
+        this->tiles->Record(
+            [&](DisplayList& list) { list.DrawBitmap(pixels, w, h, stride, x, y, blend); });
+    } else {
+        RasterBlit(screenTarget(), pixels, w, h, stride, x, y, blend);
+    }
+    MarkDirty(Rect::FromSize(x, y, w, h));
+}
 
-        // Get the glyph for the ASCII code
-        glyph_index = FT_Get_Char_Index(face, txt[n]);
+void Scene2D::DrawBitmapScaled(const uint32_t* pixels, int stride, Rect srcRect, Rect dstRect,
+                               ImageFilter filter, BlendMode const blend) {
+    if (srcRect.Empty() || dstRect.Empty()) {
+        return;
+    }
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) {
+            list.DrawBitmapScaled(pixels, stride, srcRect, dstRect, filter, blend);
+        });
+    } else {
+        RasterScaledBlit(screenTarget(), pixels, stride, srcRect, dstRect, filter, blend);
+    }
+    MarkDirty(dstRect);
+}
 
-        // Load and render in 8-bit color
-        rc = FT_Load_Glyph(face, glyph_index, FT_LOAD_DEFAULT);
+void Scene2D::drawGlyph(const CachedGlyph& glyph, int x, int y, Color bgColor, Color fgColor,
+                        BlendMode const blend) {
+    // Blend the foreground color into the frame buffer by the 8-bit bitmap's coverage
+    if (this->tiles) {
+        this->tiles->Record([&](DisplayList& list) {
+            list.DrawGlyph(glyph.coverage, glyph.width, glyph.height, glyph.pitch, x, y, fgColor,
+                           bgColor, blend);
+        });
+    } else {
+        RasterGlyph(screenTarget(), glyph.coverage, glyph.width, glyph.height, glyph.pitch, x, y,
+                    fgColor, bgColor, blend);
+    }
+    MarkDirty(Rect::FromSize(x, y, glyph.width, glyph.height));
+}
 
-        if (rc)
-            continue;
+void Scene2D::DrawText(std::string_view txt, FT_Face face, int startX, int startY, Color bgColor,
+                       Color fgColor, BlendMode const blend) {
+    RenderGlyphs(txt, face, startX, startY, [&](const CachedGlyph& glyph, int x, int y) {
+        drawGlyph(glyph, x, y, bgColor, fgColor, blend);
+    });
+}
 
-        rc = FT_Render_Glyph(slot, ft_render_mode_normal);
+void Scene2D::DrawText(std::span<const char32_t> codepoints, FT_Face face, int startX,
+                       int startY, Color bgColor, Color fgColor, BlendMode const blend) {
+    RenderGlyphs(codepoints, face, startX, startY, [&](const CachedGlyph& glyph, int x, int y) {
+        drawGlyph(glyph, x, y, bgColor, fgColor, blend);
+    });
+}
 
-        if (rc)
-            continue;
+void Scene2D::DrawText(std::string_view txt, const BakedFont& font, int startX, int startY,
+                       Color bgColor, Color fgColor, BlendMode const blend) {
+    RenderBakedGlyphs(txt, font, startX, startY, [&](const BakedGlyph& baked, int x, int y) {
+        CachedGlyph glyph{};
+        glyph.coverage = font.coverage + baked.offset;
+        glyph.pitch = baked.width;
+        glyph.width = baked.width;
+        glyph.height = baked.height;
+        drawGlyph(glyph, x, y, bgColor, fgColor, blend);
+    });
+}
 
-        // If we get a newline, increment the y offset, reset the x offset, and skip to the next
-        // character
-        if (txt[n] == '\n') {
-            xOffset = 0;
-            yOffset += 50;
+void Scene2D::DrawTextLayout(const TextLayout& layout, int x, int y, Color bgColor, Color fgColor,
+                             BlendMode const blend) {
+    if (this->tiles) {
+        this->tiles->Record(
+            [&](DisplayList& list) { list.DrawTextLayout(layout, x, y, bgColor, fgColor, blend); });
+    } else {
+        layout.Raster(screenTarget(), x, y, fgColor, bgColor, blend);
+    }
+    if (!layout.Bounds().Empty()) {
+        MarkDirty(layout.Bounds().Translate(x, y));
+    }
+}
 
-            continue;
+void Scene2D::DrawSdfText(std::string_view txt, FT_Face face, int startX, int startY,
+                          float pixelSize, const SdfTextStyle& style) {
+    auto const draw = [&](const SdfGlyph& glyph, float x, float y, float scale, bool shadow) {
+        if (this->tiles) {
+            this->tiles->Record(
+                [&](DisplayList& list) { list.DrawSdfGlyph(glyph, x, y, scale, style, shadow); });
+        } else {
+            RasterSdfGlyph(screenTarget(), glyph, x, y, scale, style, shadow);
         }
-
-        // Parse and write the bitmap to the frame buffer
-        for (int yPos = 0; yPos < slot->bitmap.rows; yPos++) {
-            for (int xPos = 0; xPos < slot->bitmap.width; xPos++) {
-                // Decode the 8-bit bitmap
-                char pixel = slot->bitmap.buffer[(yPos * slot->bitmap.width) + xPos];
-
-                // Get new pixel coordinates to account for the character position and baseline, as
-                // well as newlines
-                int x = startX + xPos + xOffset + slot->bitmap_left;
-                int y = startY + yPos + yOffset - slot->bitmap_top;
-
-                // Linearly interpolate between the foreground and background for smoother rendering
-                uint8_t r = (pixel * fgColor.r) / 255;
-                uint8_t g = (pixel * fgColor.g) / 255;
-                uint8_t b = (pixel * fgColor.b) / 255;
-
-                // Create new color struct with lerp'd values
-                Color finalColor = {r, g, b};
-
-                // We need to do bounds checking before commiting the pixel write due to our
-                // transformations, or we could write out-of-bounds of the frame buffer
-                if (x < 0 || y < 0 || x >= this->width || y >= this->height)
-                    continue;
-
-                // If the pixel in the bitmap isn't blank, we'll draw it
-                if (pixel != 0x00)
-                    this->DrawPixel(x, y, finalColor);
-            }
+        if (glyph.width != 0) {
+            MarkDirty(SdfGlyphBounds(glyph, x, y, scale, style, shadow));
         }
-
-        // Increment x offset for the next character
-        xOffset += slot->advance.x >> 6;
+    };
+
+    // Every shadow goes below every glyph
+    if (style.shadowColor.a != 0) {
+        RenderSdfGlyphs(txt, face, pixelSize, float(startX + style.shadowX),
+                        float(startY + style.shadowY),
+                        [&](const SdfGlyph& glyph, float x, float y, float scale) {
+                            draw(glyph, x, y, scale, true);
+                        });
     }
+    RenderSdfGlyphs(txt, face, pixelSize, float(startX), float(startY),
+                    [&](const SdfGlyph& glyph, float x, float y, float scale) {
+                        draw(glyph, x, y, scale, false);
+                    });
+}
+
+void Scene2D::DrawCachedText(std::string_view txt, FT_Face face, int startX, int startY,
+                             Color bgColor, Color fgColor, BlendMode const blend) {
+    DrawTextLayout(this->textLayouts.Get(txt, face), startX, startY, bgColor, fgColor, blend);
 }
@@ -1,39 +1,81 @@
+#include <limits.h>
 #include <orbis/Sysmodule.h>
-#include <orbis/VideoOut.h>
 #include <orbis/libkernel.h>
 #include <stdint.h>
 
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "baked_font.h"
+#include "color.h"
+#include "damage.h"
+#include "display_backend.h"
+#include "display_list.h"
+#include "glyph_cache.h"
+#include "image_scale.h"
+#include "raster.h"
+#include "rect.h"
+#include "sdf_text.h"
+#include "shapes.h"
+#include "stroke.h"
+#include "text_layout.h"
+#include "tile_renderer.h"
+#include "video_memory.h"
+
 #ifndef GRAPHICS_H
 #define GRAPHICS_H
 
 #include <proto-include.h>
 
-// Color is used to pack together RGB information, and is used for every function that draws colored
-// pixels.
-struct Color {
-    uint8_t r;
-    uint8_t g;
-    uint8_t b;
-};
-
 class Scene2D {
 
     int depth;
-    int video;
 
-    off_t directMemOff;
-    size_t directMemAllocationSize;
-
-    uintptr_t videoMemSP;
     void* videoMem;
+    // Hands out the memory at videoMem
+    VideoMemoryAllocator videoMemory;
 
-    OrbisKernelEqueue flipQueue;
-    OrbisVideoOutBufferAttribute attr;
+    std::unique_ptr<DisplayBackend> backend;
 
     int frameBufferCount;
+    // The flip each frame buffer was last queued with, or -1 once the buffer is known to be off
+    // screen and free to draw into
+    std::vector<s64> queuedFlips;
+
+    // What has been drawn into each frame buffer since it was last cleared
+    std::vector<DamageList> damage;
+    // Bounding box of the DrawPixel calls not yet in `damage`. A DamageList::Add per pixel would
+    // cost more than the pixel, so they only grow this until foldPixelDamage.
+    static constexpr Rect NoPixels{INT_MAX, INT_MAX, INT_MIN, INT_MIN};
+    Rect pixelDamage = NoPixels;
+    Color clearColor{50, 50, 50};
+
+    // With partial redraw, what was invalidated since each frame buffer was last drawn
+    std::vector<DamageList> stale;
+    bool partialRedraw{};
+    // Draws are clipped to this, see RedrawRect
+    Rect redrawRect{};
+
+    // Set while tiled rendering is enabled, draws are then recorded and rasterized on Flush
+    std::unique_ptr<TileRenderer> tiles;
+
+    int nextFrameBuffer() const {
+        return (this->activeFrameBufferIdx + 1) % this->frameBufferCount;
+    }
+
+    // Layouts for DrawCachedText, trimmed on Flush
+    TextLayoutCache textLayouts;
+
+    RasterTarget screenTarget() const;
+    void fillRect(Rect const& rect, Color const color, BlendMode const blend);
+    void foldPixelDamage();
+    void drawGlyph(const CachedGlyph& glyph, int x, int y, Color bgColor, Color fgColor,
+                   BlendMode const blend);
 
 public:
-    FT_Library ftLib;
+    FT_Library ftLib{};
     int width;
     int height;
     char** frameBuffers;
@@ -41,36 +83,167 @@ public:
     int frameBufferSize;
     int frame_id;
 
-    bool initFlipQueue();
+    // Display memory is aligned to this by default, the size of a GPU memory page
+    static constexpr size_t DisplayMemAlignment = 64_KB;
+    // As many as sceVideoOutRegisterBuffers takes
+    static constexpr int MaxFrameBuffers = 16;
+
+    // Replaces the frame buffers, if any, with `num` new ones
     bool allocateFrameBuffers(int num);
-    char* allocateDisplayMem(size_t size);
+    void freeFrameBuffers();
+    // Returns null, after logging, if the video memory is used up
+    char* allocateDisplayMem(size_t size, VideoMemoryTag tag = VideoMemoryTag::Other,
+                             size_t alignment = DisplayMemAlignment);
+    void freeDisplayMem(void* memory);
     bool allocateVideoMem(size_t size, int alignment);
     void deallocateVideoMem();
+    const VideoMemoryAllocator& VideoMemory() const {
+        return this->videoMemory;
+    }
 
-    Scene2D(int w, int h, int pixelDepth);
+    // Takes ownership of `displayBackend`; passing nullptr selects the platform default.
+    Scene2D(int w, int h, int pixelDepth, DisplayBackend* displayBackend = nullptr);
     ~Scene2D();
 
     bool Init(size_t memSize, int numFrameBuffers);
     int InitFontLib();
 
+    // The frame buffers form a ring: each frame is drawn into the active buffer, queued for flip
+    // with SubmitFlip, and FrameWait then blocks until the next buffer in the ring is off screen
+    // before FrameBufferSwap makes it active. With two buffers that means waiting for the frame
+    // just submitted to be displayed; with three, drawing runs a frame ahead of the display, so a
+    // frame that runs long costs a repeated vsync rather than a stall.
     void SetActiveFrameBuffer(int index);
     void SubmitFlip();
 
     void FrameWait();
     void FrameBufferSwap();
+    int FrameBufferCount() const {
+        return this->frameBufferCount;
+    }
+    // Whether buffer `index` has been queued for flip and may still be on screen or waiting to be
+    // shown
+    bool IsQueuedForFlip(int index) const {
+        return this->queuedFlips[index] >= 0;
+    }
     void FrameBufferClear();
     void FrameBufferFill(Color color);
 
-    void DrawPixel(int const x, int const y, Color const color);
-    void DrawRectangle(int const x, int const y, int const w, int const h, Color const color);
+    // With numThreads > 0, draws are binned into screen tiles and rasterized by that many threads
+    // (the caller included) when the frame is flushed. 0 goes back to drawing immediately.
+    void SetTiledRendering(int numThreads);
+    // Draws a recorded display list. In tiled mode the list is read at Flush time and must stay
+    // valid and unchanged until then.
+    void Execute(const DisplayList& list);
+    // Rasterizes draws still pending in tiled mode. SubmitFlip does this implicitly; call it before
+    // touching the frame buffer directly.
+    void Flush();
+
+    // Changes the color FrameBufferClear restores, which invalidates every frame buffer
+    void SetClearColor(Color color);
+    // Records that `rect` of the active frame buffer was drawn to by something outside of Scene2D
+    void MarkDirty(Rect rect);
+
+    // With partial redraw, a frame only redraws what changed. The caller invalidates every region
+    // whose content differs from the previous frame's; FrameBufferClear then clears, and the frame
+    // redraws, the bounding box of what was invalidated since the active buffer was last drawn
+    // (RedrawRect). Every draw is clipped to it, commands outside it are skipped, and the rest of
+    // the buffer keeps the frame it already holds. Everything is invalidated when it is turned on.
+    void SetPartialRedraw(bool enabled);
+    // Marks `rect` as changing. It is redrawn from the next FrameBufferClear on, in every buffer:
+    // invalidate before the frame starts, not while drawing it.
+    void Invalidate(Rect rect);
+    // The part of the active frame buffer the current frame redraws, the whole screen unless
+    // partial redraw is on
+    Rect RedrawRect() const {
+        return this->redrawRect;
+    }
+
+    // Pixels from DrawPixel are added once per frame, at SubmitFlip or when the active frame
+    // buffer changes
+    const DamageList& GetDamage(int index) const {
+        return damage[index];
+    }
+    Rect ScreenRect() const {
+        return {0, 0, width, height};
+    }
+
+    // Colors are blended with their alpha according to `blend`; an alpha of 255 (the default)
+    // with SrcOver draws exactly like an opaque write.
+    void DrawPixel(int const x, int const y, Color const color,
+                   BlendMode const blend = BlendMode::SrcOver);
+    void DrawRectangle(int const x, int const y, int const w, int const h, Color const color,
+                       BlendMode const blend = BlendMode::SrcOver);
     void DrawRectangleWithBorder(int const x, int const y, int const w, int const h,
-                                 Color const color, int const b_w, Color const b_color);
+                                 Color const color, int const b_w, Color const b_color,
+                                 BlendMode const blend = BlendMode::SrcOver);
+    // Lines wider than one pixel or antialiased are stroked like a two point DrawPolyline
     void DrawLine(int const p1x, int const p1y, int const dx, int const dy, int const w,
-                  Color const c);
+                  Color const c, BlendMode const blend = BlendMode::SrcOver,
+                  bool const antialias = false);
+    void DrawPolyline(std::span<const Point> points, StrokeStyle const& style, Color const c,
+                      BlendMode const blend = BlendMode::SrcOver);
+
+    // Round shapes are filled, or outlined with a band `thickness` pixels wide inside their edge
+    // (0 fills). Circles and ellipses are centered on the center of pixel (cx, cy).
+    void FillCircle(int const cx, int const cy, int const radius, Color const c,
+                    BlendMode const blend = BlendMode::SrcOver, bool const antialias = false);
+    void DrawCircle(int const cx, int const cy, int const radius, int const thickness,
+                    Color const c, BlendMode const blend = BlendMode::SrcOver,
+                    bool const antialias = false);
+    void FillEllipse(int const cx, int const cy, int const rx, int const ry, Color const c,
+                     BlendMode const blend = BlendMode::SrcOver, bool const antialias = false);
+    void DrawEllipse(int const cx, int const cy, int const rx, int const ry, int const thickness,
+                     Color const c, BlendMode const blend = BlendMode::SrcOver,
+                     bool const antialias = false);
+    // Part of a circle outline; 0 degrees points right and positive sweeps run clockwise
+    void DrawArc(int const cx, int const cy, int const radius, int const thickness,
+                 float const startDegrees, float const sweepDegrees, Color const c,
+                 BlendMode const blend = BlendMode::SrcOver, bool const antialias = false);
+    void FillRoundedRect(int const x, int const y, int const w, int const h, int const radius,
+                         Color const c, BlendMode const blend = BlendMode::SrcOver,
+                         bool const antialias = false);
+    void DrawRoundedRect(int const x, int const y, int const w, int const h, int const radius,
+                         int const thickness, Color const c,
+                         BlendMode const blend = BlendMode::SrcOver, bool const antialias = false);
+
+    // Copies a block of 32bpp pixels to the screen, or blends it using each pixel's alpha byte
+    // with any other mode. In tiled mode `pixels` is read at Flush time.
+    void DrawBitmap(const uint32_t* pixels, int const w, int const h, int const stride, int const x,
+                    int const y, BlendMode const blend = BlendMode::Replace);
+    // Stretches the `srcRect` part of a block of pixels over `dstRect`, see RasterScaledBlit
+    void DrawBitmapScaled(const uint32_t* pixels, int stride, Rect srcRect, Rect dstRect,
+                          ImageFilter filter, BlendMode const blend = BlendMode::Replace);
 
     bool InitFont(FT_Face* face, const char* fontPath, int fontSize);
 
-    void DrawText(char const* txt, FT_Face face, int startX, int startY, Color bgColor,
-                  Color fgColor);
+    // Glyph edges are blended toward bgColor by coverage, or with whatever is in the frame buffer
+    // when bgColor's alpha is 0. Pixels the glyphs don't cover are left alone either way.
+    // `txt` is UTF-8, decoded as it is drawn. Text drawn every frame can be decoded once with
+    // DecodeUtf8 and drawn from its codepoints instead.
+    void DrawText(std::string_view txt, FT_Face face, int startX, int startY, Color bgColor,
+                  Color fgColor, BlendMode const blend = BlendMode::SrcOver);
+    void DrawText(std::span<const char32_t> codepoints, FT_Face face, int startX, int startY,
+                  Color bgColor, Color fgColor, BlendMode const blend = BlendMode::SrcOver);
+    // Draws text from a font baked into the executable, which needs no FreeType: usable before
+    // the fonts are loaded. Codepoints that weren't baked are skipped.
+    void DrawText(std::string_view txt, const BakedFont& font, int startX, int startY,
+                  Color bgColor, Color fgColor, BlendMode const blend = BlendMode::SrcOver);
+    // Draws a layout with its origin (the start of its first baseline) at (x, y). In tiled mode
+    // `layout` is read at Flush time.
+    void DrawTextLayout(const TextLayout& layout, int x, int y, Color bgColor, Color fgColor,
+                        BlendMode const blend = BlendMode::SrcOver);
+    // DrawText for strings that repeat from frame to frame: the layout is built on first use and
+    // kept in a cache of recently drawn strings
+    void DrawCachedText(std::string_view txt, FT_Face face, int startX, int startY, Color bgColor,
+                        Color fgColor, BlendMode const blend = BlendMode::SrcOver);
+    // Draws text from distance fields at `pixelSize` pixels per em, whatever size the face is set
+    // to, with the outline, glow and drop shadow of `style`. Glyph fields are generated on first
+    // use and shared by every size, so changing the size every frame costs nothing extra.
+    void DrawSdfText(std::string_view txt, FT_Face face, int startX, int startY, float pixelSize,
+                     const SdfTextStyle& style);
+    TextLayoutCache& TextLayouts() {
+        return this->textLayouts;
+    }
 };
 #endif
\ No newline at end of file
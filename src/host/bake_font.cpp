@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <proto-include.h>
+
+#include "text.h"
+
+// Rasterizes the printable ASCII range of a font at the given pixel sizes into a header of
+// constant tables that baked_font.cpp compiles in. Runs on the build machine, which has FreeType,
+// so the console never loads a font to draw the baked glyphs:
+//
+//   bake_font <font.ttf> <output.h> <pixel size>...
+
+static constexpr char32_t FirstCodepoint = 0x20;
+static constexpr char32_t LastCodepoint = 0x7E;
+
+struct Glyph {
+    char32_t codepoint;
+    int left, top, width, height, advance;
+    size_t offset;
+};
+
+struct Kerning {
+    char32_t left, right;
+    int x;
+};
+
+struct Size {
+    int pixelSize;
+    FontMetrics metrics;
+    std::vector<Glyph> glyphs;
+    std::vector<Kerning> kerning;
+    std::vector<uint8_t> coverage;
+};
+
+// Loaded and rendered the way GlyphCache does it, so baked text looks like FreeType text
+static bool Bake(FT_Face face, int pixelSize, Size& size) {
+    if (FT_Set_Pixel_Sizes(face, 0, pixelSize) != 0) {
+        fprintf(stderr, "bake_font: can't set size %d\n", pixelSize);
+        return false;
+    }
+    size.pixelSize = pixelSize;
+    size.metrics = GetFontMetrics(face);
+
+    for (char32_t codepoint = FirstCodepoint; codepoint <= LastCodepoint; codepoint++) {
+        FT_UInt const index = FT_Get_Char_Index(face, codepoint);
+        if (index == 0 || FT_Load_Glyph(face, index, FT_LOAD_DEFAULT) != 0 ||
+            FT_Render_Glyph(face->glyph, ft_render_mode_normal) != 0) {
+            continue;
+        }
+
+        FT_GlyphSlot const slot = face->glyph;
+        FT_Bitmap const& bitmap = slot->bitmap;
+        Glyph glyph;
+        glyph.codepoint = codepoint;
+        glyph.left = slot->bitmap_left;
+        glyph.top = slot->bitmap_top;
+        glyph.width = int(bitmap.width);
+        glyph.height = int(bitmap.rows);
+        glyph.advance = int(slot->advance.x >> 6);
+        glyph.offset = size.coverage.size();
+        // BakedGlyph stores these in 8 bits
+        if (glyph.width > 255 || glyph.height > 255 || glyph.advance > 255) {
+            fprintf(stderr, "bake_font: glyph U+%04X too large at %dpx\n", unsigned(codepoint),
+                    pixelSize);
+            return false;
+        }
+        for (int row = 0; row < glyph.height; row++) {
+            const uint8_t* src = bitmap.buffer + row * bitmap.pitch;
+            size.coverage.insert(size.coverage.end(), src, src + glyph.width);
+        }
+        size.glyphs.push_back(glyph);
+    }
+
+    // Rounded like TextPen rounds them
+    if (FT_HAS_KERNING(face)) {
+        for (const Glyph& left : size.glyphs) {
+            for (const Glyph& right : size.glyphs) {
+                FT_Vector delta{};
+                FT_Get_Kerning(face, FT_Get_Char_Index(face, left.codepoint),
+                               FT_Get_Char_Index(face, right.codepoint), FT_KERNING_DEFAULT,
+                               &delta);
+                int const x = int(delta.x >> 6);
+                if (x != 0) {
+                    size.kerning.push_back({left.codepoint, right.codepoint, x});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static void Write(FILE* out, const Size& size) {
+    int const n = size.pixelSize;
+
+    fprintf(out, "static constexpr uint8_t kBakedCoverage%d[] = {", n);
+    for (size_t i = 0; i < size.coverage.size(); i++) {
+        fprintf(out, "%s%d,", i % 16 == 0 ? "\n    " : " ", size.coverage[i]);
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static constexpr BakedGlyph kBakedGlyphs%d[] = {\n", n);
+    for (const Glyph& glyph : size.glyphs) {
+        fprintf(out, "    {0x%02X, %d, %d, %d, %d, %d, %zu},\n", unsigned(glyph.codepoint),
+                glyph.left, glyph.top, glyph.width, glyph.height, glyph.advance, glyph.offset);
+    }
+    fprintf(out, "};\n\n");
+
+    if (!size.kerning.empty()) {
+        fprintf(out, "static constexpr BakedKerning kBakedKerning%d[] = {\n", n);
+        for (const Kerning& pair : size.kerning) {
+            fprintf(out, "    {0x%02X, 0x%02X, %d},\n", unsigned(pair.left), unsigned(pair.right),
+                    pair.x);
+        }
+        fprintf(out, "};\n\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: bake_font <font.ttf> <output.h> <pixel size>...\n");
+        return 1;
+    }
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, argv[1], 0, &face) != 0) {
+        fprintf(stderr, "bake_font: can't open %s\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<Size> sizes;
+    for (int i = 3; i < argc; i++) {
+        int const pixelSize = atoi(argv[i]);
+        if (pixelSize <= 0 || !Bake(face, pixelSize, sizes.emplace_back())) {
+            fprintf(stderr, "bake_font: can't bake size %s\n", argv[i]);
+            return 1;
+        }
+    }
+    // BakedFonts() lists them smallest first
+    std::sort(sizes.begin(), sizes.end(),
+              [](const Size& a, const Size& b) { return a.pixelSize < b.pixelSize; });
+
+    FILE* out = fopen(argv[2], "w");
+    if (!out) {
+        fprintf(stderr, "bake_font: can't write %s\n", argv[2]);
+        return 1;
+    }
+
+    std::string const font = argv[1];
+    fprintf(out, "// Generated by bake_font from %s, do not edit.\n",
+            font.substr(font.find_last_of('/') + 1).c_str());
+    fprintf(out, "#pragma once\n\n#include \"baked_font.h\"\n\n");
+    for (const Size& size : sizes) {
+        Write(out, size);
+    }
+
+    fprintf(out, "static constexpr BakedFont kBakedFonts[] = {\n");
+    for (const Size& size : sizes) {
+        int const n = size.pixelSize;
+        FontMetrics const& metrics = size.metrics;
+        fprintf(out, "    {%d, {%d, %d, %d, %d}, kBakedGlyphs%d, ", n, metrics.ascent,
+                metrics.descent, metrics.lineGap, metrics.lineHeight, n);
+        if (size.kerning.empty()) {
+            fprintf(out, "{}, kBakedCoverage%d},\n", n);
+        } else {
+            fprintf(out, "kBakedKerning%d, kBakedCoverage%d},\n", n, n);
+        }
+    }
+    fprintf(out, "};\n");
+
+    fclose(out);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
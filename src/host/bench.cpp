@@ -0,0 +1,601 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "camera.h"
+#include "glyph_cache.h"
+#include "logging.h"
+#include "renderer.h"
+#include "text.h"
+#include "utf8.h"
+
+// Microbenchmarks for the Scene2D/Renderer primitives and the camera converters.
+//
+//   bench [--filter <substr>] [--min-time <seconds>] [--json <out.json>]
+//         [--baseline <in.json>] [--tolerance <fraction>]
+//
+// Every benchmark declares how many pixels and bytes one iteration touches, so results are
+// reported as ns/pixel, pixels/s and bytes/s. With --baseline, a benchmark whose ns/pixel grew by
+// more than --tolerance (default 0.10) over the stored run counts as a regression and the exit
+// code is 1. A baseline that can't be read, or holds no results, exits with 3 before anything
+// runs, so a mistyped path can't pass a CI check.
+
+struct Benchmark {
+    std::string name;
+    u64 pixels; // pixels touched per iteration
+    u64 bytes;  // bytes read + written per iteration
+    std::function<void()> fn;
+};
+
+struct BenchResult {
+    std::string name;
+    double nsPerPixel;
+    double pixelsPerSecond;
+    double bytesPerSecond;
+};
+
+struct BenchOptions {
+    std::string filter;
+    std::string jsonPath;
+    std::string baselinePath;
+    double minTime = 0.2;
+    double tolerance = 0.10;
+};
+
+static BenchResult RunBenchmark(const Benchmark& bench, double minTime) {
+    using Clock = std::chrono::steady_clock;
+
+    // Warm up, then grow the iteration count until one batch runs long enough to time reliably
+    bench.fn();
+    u64 iterations = 1;
+    double seconds = 0.0;
+    for (;;) {
+        auto const start = Clock::now();
+        for (u64 i = 0; i < iterations; i++) {
+            bench.fn();
+        }
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds >= minTime) {
+            break;
+        }
+        u64 const scale = seconds > 0.0 ? u64(minTime * 1.2 / seconds) + 1 : 10;
+        iterations *= std::clamp<u64>(scale, 2, 10);
+    }
+
+    // Best of three batches, to keep scheduler noise out of the comparison
+    for (int run = 0; run < 2; run++) {
+        auto const start = Clock::now();
+        for (u64 i = 0; i < iterations; i++) {
+            bench.fn();
+        }
+        seconds = std::min(seconds, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+
+    double const pixels = double(bench.pixels) * iterations;
+    double const bytes = double(bench.bytes) * iterations;
+    return {bench.name, seconds * 1e9 / pixels, pixels / seconds, bytes / seconds};
+}
+
+static bool WriteJson(const std::string& path, const std::vector<BenchResult>& results) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        LOG_ERROR("Failed to open {} for writing", path);
+        return false;
+    }
+    fprintf(file, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        fprintf(file,
+                "    {\"name\": \"%s\", \"ns_per_pixel\": %.6f, \"pixels_per_second\": %.1f, "
+                "\"bytes_per_second\": %.1f}%s\n",
+                r.name.c_str(), r.nsPerPixel, r.pixelsPerSecond, r.bytesPerSecond,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    return true;
+}
+
+// Reads back the name/ns_per_pixel pairs of a file written by WriteJson
+static bool ReadJson(const std::string& path, std::vector<BenchResult>& results) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) {
+        LOG_ERROR("Failed to open baseline {}", path);
+        return false;
+    }
+    std::string text;
+    char chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), file)) > 0;) {
+        text.append(chunk, n);
+    }
+    fclose(file);
+
+    constexpr std::string_view nameKey = "\"name\": \"";
+    constexpr std::string_view nsKey = "\"ns_per_pixel\": ";
+    for (size_t pos = text.find(nameKey); pos != std::string::npos;
+         pos = text.find(nameKey, pos)) {
+        pos += nameKey.size();
+        size_t const nameEnd = text.find('"', pos);
+        size_t const ns = text.find(nsKey, nameEnd);
+        if (nameEnd == std::string::npos || ns == std::string::npos) {
+            break;
+        }
+        results.push_back({text.substr(pos, nameEnd - pos),
+                           strtod(text.c_str() + ns + nsKey.size(), nullptr), 0.0, 0.0});
+        pos = ns;
+    }
+    if (results.empty()) {
+        LOG_ERROR("Baseline {} has no benchmark results", path);
+        return false;
+    }
+    return true;
+}
+
+// Sums the glyph bitmap area of `txt`, the number of pixels DrawText actually visits
+static u64 TextPixels(FT_Face face, std::string_view txt) {
+    u64 pixels = 0;
+    for (char32_t const c : DecodeUtf8(txt)) {
+        if (c != U'\n' && FT_Load_Char(face, c, FT_LOAD_RENDER) == 0) {
+            pixels += u64(face->glyph->bitmap.width) * face->glyph->bitmap.rows;
+        }
+    }
+    return std::max<u64>(pixels, 1);
+}
+
+// A busy frame: overlapping rectangles, lines, text and a large blit over the whole screen
+static void DrawHeavyScene(Renderer& renderer, const Image& img) {
+    Scene2D* scene = renderer.scene;
+    renderer.BeginFrame();
+    for (int i = 0; i < 64; i++) {
+        u8 const shade = u8(i * 4);
+        scene->DrawRectangle((i * 97) % 1700, (i * 53) % 900, 220, 180,
+                             {shade, 64, u8(255 - shade)});
+        scene->DrawLine((i * 131) % 1900, (i * 71) % 1000, 300 - i * 9, 200 - i * 5, 5,
+                        {255, shade, 0});
+    }
+    for (int i = 0; i < 8; i++) {
+        scene->DrawText("Tiled rendering", renderer.font, 40 + i * 180, 120 + i * 120,
+                        {50, 50, 50}, {255, 255, 255});
+    }
+    renderer.DrawImage(img, 320, 140);
+    scene->Flush();
+}
+
+static std::vector<Benchmark> CreateBenchmarks(Renderer& renderer, Renderer& tiledRenderer,
+                                               std::vector<Image>& images,
+                                               std::vector<std::vector<u8>>& buffers) {
+    Scene2D* scene = renderer.scene;
+    int const w = scene->width;
+    int const h = scene->height;
+    Color const color = {255, 128, 64};
+    std::vector<Benchmark> benches;
+
+    benches.push_back({"DrawPixel/fullscreen", u64(w) * h, u64(w) * h * 4, [=] {
+                           for (int y = 0; y < h; y++) {
+                               for (int x = 0; x < w; x++) {
+                                   scene->DrawPixel(x, y, color);
+                               }
+                           }
+                       }});
+
+    for (int size : {16, 256}) {
+        u64 const pixels = u64(size) * size;
+        benches.push_back({fmt::format("DrawRectangle/{}x{}", size, size), pixels, pixels * 4,
+                           [=] { scene->DrawRectangle(100, 100, size, size, color); }});
+    }
+    benches.push_back({"DrawRectangle/fullscreen", u64(w) * h, u64(w) * h * 4,
+                       [=] { scene->DrawRectangle(0, 0, w, h, color); }});
+    benches.push_back({"DrawRectangle/clipped", 256 * 256, 256 * 256 * 4,
+                       [=] { scene->DrawRectangle(w - 256, -256, 512, 512, color); }});
+
+    for (auto [name, mode] : {std::pair{"SrcOver", BlendMode::SrcOver},
+                              std::pair{"Additive", BlendMode::Additive},
+                              std::pair{"Multiply", BlendMode::Multiply}}) {
+        // read and write every pixel
+        benches.push_back({fmt::format("DrawRectangle/256x256/{}", name), 256 * 256,
+                           256 * 256 * 8, [=, mode = mode] {
+                               scene->DrawRectangle(100, 100, 256, 256, {255, 128, 64, 160},
+                                                    mode);
+                           }});
+    }
+
+    benches.push_back({"DrawRectangleWithBorder/512x512", 512 * 512, 512 * 512 * 4, [=] {
+                           scene->DrawRectangleWithBorder(100, 100, 512, 512, color, 8,
+                                                          {0, 0, 0});
+                       }});
+
+    for (int width : {1, 3, 9, 17}) {
+        // A 1 pixel 45 degree line visits 1000 pixels, wider ones cover a 1413 pixel long rectangle
+        // plus its caps
+        u64 const pixels = width == 1 ? 1000 : u64(width) * (1413 + width);
+        benches.push_back({fmt::format("DrawLine/w{}", width), pixels, pixels * 4,
+                           [=] { scene->DrawLine(200, 40, 999, 999, width, color); }});
+        benches.push_back({fmt::format("DrawLine/w{}/antialiased", width), pixels, pixels * 8,
+                           [=] {
+                               scene->DrawLine(200, 40, 999, 999, width, color,
+                                               BlendMode::SrcOver, true);
+                           }});
+    }
+
+    // A graph of 2000 segments across the screen
+    static std::vector<Point> graph;
+    double length = 0;
+    for (int i = 0; i < 2000; i++) {
+        graph.push_back({i * w / 2000, int(h / 2 + (h / 3) * sinf(i * 0.05f))});
+        if (i > 0) {
+            length += hypot(graph[i].x - graph[i - 1].x, graph[i].y - graph[i - 1].y);
+        }
+    }
+    for (bool antialias : {false, true}) {
+        // Roughly the curve's length times its width
+        u64 const pixels = u64(length * 3);
+        StrokeStyle const style = {3, LineJoin::Bevel, antialias};
+        benches.push_back({fmt::format("DrawPolyline/2000{}", antialias ? "/antialiased" : ""),
+                           pixels, pixels * 4,
+                           [=] { scene->DrawPolyline(graph, style, color); }});
+    }
+
+    // Round shapes against the 256x256 rectangle above: a disc of the same bounding box covers
+    // pi/4 of its area
+    u64 const discPixels = u64(M_PI * 128 * 128);
+    for (bool antialias : {false, true}) {
+        std::string const suffix = antialias ? "/antialiased" : "";
+        benches.push_back({"FillCircle/r128" + suffix, discPixels, discPixels * 4, [=] {
+                               scene->FillCircle(228, 228, 128, color, BlendMode::SrcOver,
+                                                 antialias);
+                           }});
+        u64 const ringPixels = u64(M_PI * (128 * 128 - 120 * 120));
+        benches.push_back({"DrawCircle/r128/t8" + suffix, ringPixels, ringPixels * 4, [=] {
+                               scene->DrawCircle(228, 228, 128, 8, color, BlendMode::SrcOver,
+                                                 antialias);
+                           }});
+        benches.push_back({"DrawArc/r128/t8/270" + suffix, ringPixels * 3 / 4,
+                           ringPixels * 3, [=] {
+                               scene->DrawArc(228, 228, 128, 8, -90, 270, color,
+                                              BlendMode::SrcOver, antialias);
+                           }});
+        u64 const roundedPixels = 256 * 256 - u64((4 - M_PI) * 32 * 32);
+        benches.push_back({"FillRoundedRect/256x256/r32" + suffix, roundedPixels,
+                           roundedPixels * 4, [=] {
+                               scene->FillRoundedRect(100, 100, 256, 256, 32, color,
+                                                      BlendMode::SrcOver, antialias);
+                           }});
+    }
+
+    static const char* shortText = "Hello";
+    static const char* longText =
+        "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs. "
+        "Sphinx of black quartz, judge my vow.";
+    for (auto [name, txt] : {std::pair{"short", shortText}, std::pair{"long", longText}}) {
+        u64 const pixels = TextPixels(renderer.font, txt);
+        benches.push_back({fmt::format("DrawText/{}", name), pixels, pixels * 4, [=, &renderer] {
+                               scene->DrawText(txt, renderer.font, 0, 100, {50, 50, 50},
+                                               {255, 255, 255});
+                           }});
+    }
+    u64 const longPixels = TextPixels(renderer.font, longText);
+    // Glyph edges blended with the frame buffer instead of a known background
+    benches.push_back({"DrawText/long/overFrameBuffer", longPixels, longPixels * 8,
+                       [=, &renderer] {
+                           scene->DrawText(longText, renderer.font, 0, 100, {0, 0, 0, 0},
+                                           {255, 255, 255});
+                       }});
+    // Mostly two and three byte sequences, decoded while drawing or once up front
+    static const char* utf8Text = "Ελληνικά και русский текст, ünïcödé — 1½ €";
+    static const std::u32string utf8Codepoints = DecodeUtf8(utf8Text);
+    u64 const utf8Pixels = TextPixels(renderer.font, utf8Text);
+    benches.push_back({"DrawText/utf8", utf8Pixels, utf8Pixels * 4, [=, &renderer] {
+                           scene->DrawText(utf8Text, renderer.font, 0, 100, {50, 50, 50},
+                                           {255, 255, 255});
+                       }});
+    benches.push_back({"DrawText/utf8/predecoded", utf8Pixels, utf8Pixels * 4, [=, &renderer] {
+                           scene->DrawText(utf8Codepoints, renderer.font, 0, 100, {50, 50, 50},
+                                           {255, 255, 255});
+                       }});
+    // 4 KiB of text in 64 character lines, most of it below the screen: layout dominates
+    static std::string paragraph;
+    for (int i = 0; paragraph.size() < 4096; i++) {
+        paragraph += std::string_view(longText).substr(i % 32, 63);
+        paragraph += '\n';
+    }
+    u64 const paragraphPixels = TextPixels(renderer.font, paragraph);
+    benches.push_back({"DrawText/4KiB", paragraphPixels, paragraphPixels * 4, [=, &renderer] {
+                           scene->DrawText(paragraph, renderer.font, 0, 100, {50, 50, 50},
+                                           {255, 255, 255});
+                       }});
+    // Starting from an empty cache every time, each distinct glyph goes through FreeType
+    benches.push_back({"DrawText/long/cold", longPixels, longPixels * 4, [=, &renderer] {
+                           GlyphCache::Shared().Clear();
+                           scene->DrawText(longText, renderer.font, 0, 100, {50, 50, 50},
+                                           {255, 255, 255});
+                       }});
+    // Labels at three sizes, each size its own face from the font manager
+    FT_Face const mixedFaces[] = {renderer.fonts->Get(renderer.systemFont, 24),
+                                  renderer.fonts->Get(renderer.systemFont, 48), renderer.font};
+    u64 mixedPixels = 0;
+    for (FT_Face const face : mixedFaces) {
+        mixedPixels += TextPixels(face, longText);
+    }
+    benches.push_back({"DrawText/long/mixedSizes", mixedPixels, mixedPixels * 4, [=] {
+                           for (FT_Face const face : mixedFaces) {
+                               scene->DrawText(longText, face, 0, 100, {50, 50, 50},
+                                               {255, 255, 255});
+                           }
+                       }});
+    // Compiled-in glyphs, against FreeType glyphs from the cache at the same size
+    const BakedFont& baked = FindBakedFont(32);
+    u64 bakedPixels = 0;
+    RenderBakedGlyphs(longText, baked, 0, 0, [&](const BakedGlyph& glyph, int, int) {
+        bakedPixels += u64(glyph.width) * glyph.height;
+    });
+    benches.push_back({"DrawText/long/baked", bakedPixels, bakedPixels * 4, [=, &baked] {
+                           scene->DrawText(longText, baked, 0, 100, {50, 50, 50},
+                                           {255, 255, 255});
+                       }});
+    FT_Face const face32 = renderer.fonts->Get(renderer.systemFont, 32);
+    u64 const pixels32 = TextPixels(face32, longText);
+    benches.push_back({"DrawText/long/32px", pixels32, pixels32 * 4, [=] {
+                           scene->DrawText(longText, face32, 0, 100, {50, 50, 50},
+                                           {255, 255, 255});
+                       }});
+    // Distance field text at the face's own size, against the bitmap glyph pixels of DrawText
+    SdfTextStyle const sdfPlain;
+    SdfTextStyle sdfEffects;
+    sdfEffects.outlineWidth = 3.0f;
+    sdfEffects.glowRadius = 6.0f;
+    sdfEffects.glowColor = {80, 200, 255};
+    sdfEffects.shadowX = 4;
+    sdfEffects.shadowY = 4;
+    sdfEffects.shadowColor = {0, 0, 0, 160};
+    for (auto [name, style] : {std::pair{"", sdfPlain}, std::pair{"/effects", sdfEffects}}) {
+        benches.push_back({fmt::format("DrawSdfText/long{}", name), longPixels, longPixels * 8,
+                           [=, &renderer, style = style] {
+                               scene->DrawSdfText(longText, renderer.font, 0, 100, 80.0f, style);
+                           }});
+    }
+    benches.push_back({"DrawSdfText/long/cold", longPixels, longPixels * 8, [=, &renderer] {
+                           SdfGlyphCache::Shared().Clear();
+                           scene->DrawSdfText(longText, renderer.font, 0, 100, 80.0f, sdfPlain);
+                       }});
+    // The same strings laid out once, looked up by text or drawn from a held layout
+    for (auto [name, txt] : {std::pair{"long", std::string_view(longText)},
+                             std::pair{"4KiB", std::string_view(paragraph)}}) {
+        u64 const pixels = TextPixels(renderer.font, txt);
+        benches.push_back({fmt::format("DrawCachedText/{}", name), pixels, pixels * 4,
+                           [=, &renderer] {
+                               scene->DrawCachedText(txt, renderer.font, 0, 100, {50, 50, 50},
+                                                     {255, 255, 255});
+                           }});
+        auto const layout = std::make_shared<TextLayout>(txt, renderer.font);
+        benches.push_back({fmt::format("DrawTextLayout/{}", name), pixels, pixels * 4, [=] {
+                               scene->DrawTextLayout(*layout, 0, 100, {50, 50, 50},
+                                                     {255, 255, 255});
+                           }});
+        // Rendered once, then blitted; not for the paragraph, whose surface would be mostly
+        // off screen
+        if (name == std::string_view("long")) {
+            auto const surface = std::make_shared<TextSurface>();
+            surface->Update(txt, renderer.font, {255, 255, 255});
+            benches.push_back({"DrawTextSurface/long", pixels, pixels * 8, [=, &renderer] {
+                                   renderer.DrawText(*surface, txt, renderer.font, 0, 100,
+                                                     {255, 255, 255});
+                               }});
+        }
+        // Against the pixels drawing would touch, to compare with DrawText
+        benches.push_back({fmt::format("MeasureText/{}", name), pixels, 0, [=, &renderer] {
+                               TextMetrics const metrics = MeasureText(txt, renderer.font);
+                               asm volatile("" : : "g"(metrics.width) : "memory");
+                           }});
+    }
+
+    // Image sizes, with a position that keeps them on screen and one that clips half away
+    for (auto [iw, ih] : {std::pair{64, 64}, std::pair{256, 256}, std::pair{1280, 800}}) {
+        Image& img = images.emplace_back();
+        img.Allocate(iw, ih);
+        memset(img.pixels, 0x80, size_t(img.stride) * ih * 4);
+        u64 const pixels = u64(iw) * ih;
+        // read the source, write the frame buffer
+        benches.push_back({fmt::format("DrawImage/{}x{}", iw, ih), pixels, pixels * 8,
+                           [&renderer, &img] { renderer.DrawImage(img, 10, 10); }});
+        benches.push_back({fmt::format("DrawImage/{}x{}/clipped", iw, ih), pixels / 2,
+                           pixels * 4, [&renderer, &img, w] {
+                               renderer.DrawImage(img, w - img.width / 2, 10);
+                           }});
+    }
+
+    // A sprite-sized image made and dropped, as for short-lived text and icons: after the first
+    // iteration the pool reuses the same block
+    benches.push_back({"Image::Allocate/64x64", 64 * 64, 0, [] {
+                           Image sprite;
+                           sprite.Allocate(64, 64);
+                           asm volatile("" : : "g"(sprite.pixels) : "memory");
+                       }});
+
+    // Alpha varies per pixel, so most of the image takes the blending path
+    Image& alphaImage = images.emplace_back();
+    alphaImage.Allocate(256, 256);
+    for (int y = 0; y < alphaImage.height; y++) {
+        for (int x = 0; x < alphaImage.width; x++) {
+            alphaImage.pixels[y * alphaImage.stride + x] = u32(x) << 24 | u32(y) << 8 | 0x40;
+        }
+    }
+    benches.push_back({"DrawImage/256x256/SrcOver", 256 * 256, 256 * 256 * 12,
+                       [&renderer, &alphaImage] {
+                           renderer.DrawImage(alphaImage, 10, 10, BlendMode::SrcOver);
+                       }});
+
+    int const camW = 1280;
+    int const camH = 800;
+    Image& camImage = images.emplace_back();
+    camImage.Allocate(camW, camH);
+    u64 const camPixels = u64(camW) * camH;
+
+    // Capture the data pointers, `buffers` may reallocate but the storage itself stays put
+    std::vector<u8>& yuv = buffers.emplace_back(camPixels * 2);
+    for (size_t i = 0; i < yuv.size(); i++) {
+        yuv[i] = u8(i * 7);
+    }
+    benches.push_back({"Camera::ConvertYUV422/1280x800", camPixels, camPixels * (2 + 4),
+                       [src = yuv.data(), &camImage] {
+                           Camera::ConvertYUV422(src, camW, camH, camImage);
+                       }});
+
+    std::vector<u8>& raw = buffers.emplace_back(camPixels * 2);
+    for (size_t i = 0; i < raw.size(); i++) {
+        raw[i] = u8(i * 13);
+    }
+    benches.push_back({"Camera::ConvertRAW16/1280x800", camPixels, camPixels * (2 + 4),
+                       [src = raw.data(), &camImage] {
+                           Camera::ConvertRAW16(src, camW, camH, camImage);
+                       }});
+
+    // The middle of the camera frame, drawn from the frame itself
+    benches.push_back({"DrawImage/1280x800/crop640x400", 640 * 400, 640 * 400 * 8,
+                       [&renderer, &camImage] {
+                           renderer.DrawImage(camImage.View().Sub(320, 200, 640, 400), 10, 10);
+                       }});
+
+    // The camera frame stretched to the screen and shrunk to a thumbnail, per destination pixel
+    for (auto [name, filter] : {std::pair{"nearest", ImageFilter::Nearest},
+                                std::pair{"bilinear", ImageFilter::Bilinear}}) {
+        benches.push_back({fmt::format("DrawImageScaled/1280x800to1920x1080/{}", name),
+                           u64(w) * h, u64(w) * h * 8, [&renderer, &camImage, filter, w, h] {
+                               renderer.DrawImageScaled(camImage, 0, 0, w, h, filter);
+                           }});
+    }
+    for (auto [name, filter] : {std::pair{"bilinear", ImageFilter::Bilinear},
+                                std::pair{"box", ImageFilter::Box}}) {
+        benches.push_back({fmt::format("DrawImageScaled/1280x800to320x200/{}", name),
+                           320 * 200, 320 * 200 * 4, [&renderer, &camImage, filter] {
+                               renderer.DrawImageScaled(camImage, 10, 10, 320, 200, filter);
+                           }});
+    }
+
+    // Whole frames, drawn immediately and through the tiled renderer
+    Image& sceneImage = images.emplace_back();
+    sceneImage.Allocate(1280, 800);
+    memset(sceneImage.pixels, 0x40, size_t(sceneImage.stride) * sceneImage.height * 4);
+    u64 const screenPixels = u64(w) * h;
+    benches.push_back({"Scene/immediate", screenPixels, screenPixels * 4,
+                       [&renderer, &sceneImage] { DrawHeavyScene(renderer, sceneImage); }});
+    benches.push_back({"Scene/tiled", screenPixels, screenPixels * 4,
+                       [&tiledRenderer, &sceneImage] {
+                           DrawHeavyScene(tiledRenderer, sceneImage);
+                       }});
+
+    // The same frame recorded once and replayed, as a static screen would be
+    static DisplayList sceneList;
+    sceneList.Clear();
+    for (int i = 0; i < 64; i++) {
+        u8 const shade = u8(i * 4);
+        sceneList.FillRect(Rect::FromSize((i * 97) % 1700, (i * 53) % 900, 220, 180),
+                           {shade, 64, u8(255 - shade)});
+        sceneList.DrawLine((i * 131) % 1900, (i * 71) % 1000, 300 - i * 9, 200 - i * 5, 5,
+                           {255, shade, 0});
+    }
+    for (int i = 0; i < 8; i++) {
+        sceneList.DrawText("Tiled rendering", renderer.font, 40 + i * 180, 120 + i * 120,
+                           {50, 50, 50}, {255, 255, 255});
+    }
+    sceneList.DrawImage(sceneImage, 320, 140);
+    benches.push_back({"Scene/replay", screenPixels, screenPixels * 4, [&renderer] {
+                           renderer.BeginFrame();
+                           renderer.scene->Execute(sceneList);
+                       }});
+
+    return benches;
+}
+
+static bool ParseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string_view const arg = argv[i];
+        if (i + 1 >= argc) {
+            LOG_ERROR("Missing value for {}", arg);
+            return false;
+        }
+        if (arg == "--filter") {
+            options.filter = argv[++i];
+        } else if (arg == "--json") {
+            options.jsonPath = argv[++i];
+        } else if (arg == "--baseline") {
+            options.baselinePath = argv[++i];
+        } else if (arg == "--min-time") {
+            options.minTime = atof(argv[++i]);
+        } else if (arg == "--tolerance") {
+            options.tolerance = atof(argv[++i]);
+        } else {
+            LOG_ERROR("Unknown option {}", arg);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options{};
+    if (!ParseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    std::vector<BenchResult> baseline;
+    if (!options.baselinePath.empty() && !ReadJson(options.baselinePath, baseline)) {
+        return 3;
+    }
+
+    Renderer renderer{};
+    Renderer tiledRenderer{};
+    tiledRenderer.scene->SetTiledRendering(std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<Image> images;
+    std::vector<std::vector<u8>> buffers;
+    images.reserve(16);
+    std::vector<Benchmark> const benches =
+        CreateBenchmarks(renderer, tiledRenderer, images, buffers);
+
+    std::vector<BenchResult> results;
+    LOG_RAW("{:<40} {:>12} {:>14} {:>12}\n", "benchmark", "ns/pixel", "Mpixels/s", "GB/s");
+    for (const Benchmark& bench : benches) {
+        if (!options.filter.empty() && bench.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        BenchResult const& r = results.emplace_back(RunBenchmark(bench, options.minTime));
+        LOG_RAW("{:<40} {:>12.4f} {:>14.1f} {:>12.2f}\n", r.name, r.nsPerPixel,
+                r.pixelsPerSecond / 1e6, r.bytesPerSecond / 1e9);
+    }
+
+    if (!options.jsonPath.empty() && !WriteJson(options.jsonPath, results)) {
+        return 2;
+    }
+
+    if (options.baselinePath.empty()) {
+        return 0;
+    }
+
+    int regressions = 0;
+    for (const BenchResult& base : baseline) {
+        auto it = std::find_if(results.begin(), results.end(),
+                               [&](const BenchResult& r) { return r.name == base.name; });
+        if (it == results.end()) {
+            // Renamed, removed or filtered out; either way it isn't being compared
+            LOG_WARNING("{} is in the baseline but wasn't run", base.name);
+            continue;
+        }
+        double const change = it->nsPerPixel / base.nsPerPixel - 1.0;
+        if (change > options.tolerance) {
+            LOG_RAW("REGRESSION {}: {:.4f} -> {:.4f} ns/pixel ({:+.1f}%)\n", base.name,
+                    base.nsPerPixel, it->nsPerPixel, change * 100.0);
+            regressions++;
+        }
+    }
+    LOG_RAW("{} regression(s) against {}\n", regressions, options.baselinePath);
+    return regressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,375 @@
+#include <stdio.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "display_list.h"
+#include "logging.h"
+#include "renderer.h"
+
+// Golden image tests: renders fixed scenes and compares a hash of each frame against the hashes
+// checked in as golden.txt, next to this file. Every scene is drawn both immediately and with
+// tiled rendering, and both have to match the same hash, so a rasterizer change that moves a
+// single pixel, or a tiled path that drifts from the immediate one, fails the scene it shows in.
+//
+//   golden <golden.txt> [--update] [--dump <dir>]
+//
+// After an intended change, --update rewrites the hashes and --dump writes each scene as a PPM to
+// look over before checking them in. Text goes through FreeType and the font HOST_FONT_PATH
+// points to, DejaVu Sans by default, so the text scenes are only stable for a given font file.
+
+struct GoldenScene {
+    const char* name;
+    void (*draw)(Renderer& renderer, const Image& image);
+};
+
+static void RectsScene(Renderer& renderer, const Image&) {
+    Scene2D* scene = renderer.scene;
+    for (int i = 0; i < 12; i++) {
+        scene->DrawRectangle(i * 150 - 40, i * 80 - 30, 260, 190,
+                             {u8(i * 20), u8(255 - i * 20), u8(i * 7)});
+    }
+    // Clipped by every edge of the screen
+    scene->DrawRectangle(-100, 500, 300, 100, {255, 255, 255});
+    scene->DrawRectangle(1800, 600, 300, 100, {255, 255, 255});
+    scene->DrawRectangle(900, -50, 100, 120, {255, 255, 255});
+    scene->DrawRectangle(900, 1030, 100, 120, {255, 255, 255});
+    scene->DrawRectangleWithBorder(300, 800, 500, 200, {40, 40, 60}, 12, {200, 200, 200});
+    for (int i = 0; i < 24; i++) {
+        scene->DrawLine(1400, 300, (i % 6) * 80 - 200, (i / 6) * 90 - 150, 1 + i % 4,
+                        {255, 255, 255});
+    }
+    for (int i = 0; i < 200; i++) {
+        scene->DrawPixel(1000 + (i * 37) % 300, 900 + (i * 53) % 150, {255, 0, u8(i)});
+    }
+}
+
+static void BlitScene(Renderer& renderer, const Image& image) {
+    for (int i = 0; i < 6; i++) {
+        renderer.DrawImage(image, 200 + i * 230, 150 + i * 120);
+    }
+    // Partly off the screen on each side
+    renderer.DrawImage(image, -60, 500);
+    renderer.DrawImage(image, 1850, 40);
+    renderer.DrawImage(image, 700, -50);
+    renderer.DrawImage(image, 1200, 1020);
+    // Crops through views: a corner, one clipped by the image's edge, and one outside it
+    ImageView const view = image;
+    renderer.DrawImage(view.Sub(40, 30, 70, 50), 1500, 700);
+    renderer.DrawImage(view.Sub(120, 90, 100, 100), 1600, 700);
+    renderer.DrawImage(view.Sub(200, 0, 50, 50), 1700, 700);
+    // A source rect reaching past the image keeps the visible part where it would have been
+    renderer.DrawImageRect(image, Rect::FromSize(80, 60, 160, 120),
+                           Rect::FromSize(1500, 820, 320, 240), ImageFilter::Nearest);
+}
+
+static void TextScene(Renderer& renderer, const Image&) {
+    Scene2D* scene = renderer.scene;
+    scene->DrawText("FreeType text, opaque background", renderer.font, 40, 120, {50, 50, 50},
+                    {255, 255, 255});
+    scene->DrawRectangle(0, 200, 1920, 300, {200, 120, 40});
+    scene->DrawText("Drawn over the frame\nover two lines", renderer.font, 40, 300,
+                    {0, 0, 0, 0}, {20, 20, 80});
+    // Two and three byte UTF-8 sequences
+    scene->DrawText("Ελληνικά, русский, ünïcödé — 1½ €", renderer.font, 40, 640, {50, 50, 50},
+                    {255, 255, 255});
+    // Laid out on the first call, drawn from the layout cache on the second
+    for (int i = 0; i < 2; i++) {
+        scene->DrawCachedText("Cached layout\nsecond line", renderer.font, 40 + i * 700, 820,
+                              {50, 50, 50}, {120, 220, 255});
+    }
+    // Baked into the executable, so it doesn't depend on HOST_FONT_PATH
+    scene->DrawText("Baked font, no FreeType\nneeded", FindBakedFont(32), 1450, 820,
+                    {50, 50, 50}, {255, 200, 120});
+}
+
+static void BlendScene(Renderer& renderer, const Image& image) {
+    Scene2D* scene = renderer.scene;
+    for (int i = 0; i < 8; i++) {
+        scene->DrawRectangle(i * 240, 0, 240, 1080, {u8(i * 32), u8(200 - i * 20), 120});
+    }
+    BlendMode const modes[] = {BlendMode::Replace, BlendMode::SrcOver, BlendMode::Additive,
+                               BlendMode::Multiply, BlendMode::PremulSrcOver};
+    for (int i = 0; i < 5; i++) {
+        // Odd sizes and offsets, so spans end in the middle of a 128-bit register
+        scene->DrawRectangle(50 + i * 370, 80, 301, 203, {240, 180, 40, 150}, modes[i]);
+        scene->DrawRectangle(50 + i * 370, 320, 301, 203, {40, 90, 250, 0}, modes[i]);
+        renderer.DrawImage(image, 93 + i * 370, 600, modes[i]);
+        scene->DrawLine(50 + i * 370, 820, 300, 150, 3, {255, 255, 255, 100}, modes[i]);
+    }
+    scene->DrawText("Translucent text", renderer.font, 40, 1000, {0, 0, 0, 0},
+                    {255, 255, 255, 128});
+}
+
+static void StrokeScene(Renderer& renderer, const Image&) {
+    Scene2D* scene = renderer.scene;
+    // A zigzag with sharp and shallow turns, once per join, solid and antialiased
+    LineJoin const joins[] = {LineJoin::None, LineJoin::Bevel, LineJoin::Round};
+    for (int j = 0; j < 3; j++) {
+        for (int aa = 0; aa < 2; aa++) {
+            int const x = 80 + j * 600 + aa * 300;
+            Point const points[] = {{x, 100}, {x + 200, 180}, {x + 40, 300}, {x + 240, 330},
+                                    {x + 60, 520}, {x + 250, 500}};
+            StrokeStyle const style{.width = 2 + j * 9, .join = joins[j], .antialias = aa == 1};
+            scene->DrawPolyline(points, style, {255, 220, 120});
+            scene->DrawPolyline(points, style, {80, 160, 255, 120});
+        }
+    }
+    // Translucent and wide, where any pixel covered twice would show
+    for (int i = 0; i < 16; i++) {
+        scene->DrawLine(960, 820, (i - 8) * 110, i % 2 == 0 ? -200 : 200, 1 + i,
+                        {255, 255, 255, 90}, BlendMode::SrcOver, i % 3 == 0);
+    }
+}
+
+static void ShapesScene(Renderer& renderer, const Image&) {
+    Scene2D* scene = renderer.scene;
+    BlendMode const srcOver = BlendMode::SrcOver;
+    // Top row aliased, bottom row antialiased and translucent over a bar
+    scene->DrawRectangle(0, 690, 1920, 120, {200, 60, 60});
+    for (int aa = 0; aa < 2; aa++) {
+        bool const antialias = aa == 1;
+        int const y = 250 + aa * 500;
+        Color const fill = {100, 200, u8(150 + aa * 100), u8(255 - aa * 95)};
+        scene->FillCircle(150, y, 101, fill, srcOver, antialias);
+        scene->DrawCircle(400, y, 120, 7, {255, 255, 255}, srcOver, antialias);
+        scene->FillEllipse(700, y, 140, 60, fill, srcOver, antialias);
+        scene->DrawEllipse(980, y, 50, 170, 12, fill, srcOver, antialias);
+        scene->DrawArc(1250, y, 150, 20, -30.0f, 250.0f, {255, 200, 0}, srcOver, antialias);
+        scene->FillRoundedRect(1450, y - 150, 200, 300, 45, fill, srcOver, antialias);
+        scene->DrawRoundedRect(1700, y - 100, 191, 201, 120, 9, fill, srcOver, antialias);
+    }
+    // Clipped by the screen edges
+    scene->FillCircle(-20, 540, 90, {255, 255, 0});
+    scene->DrawEllipse(1900, 1060, 200, 100, 0, {0, 255, 255}, srcOver, true);
+}
+
+static void SdfTextScene(Renderer& renderer, const Image&) {
+    Scene2D* scene = renderer.scene;
+    // The styled text goes over a light background, where the shadow and glow show
+    scene->DrawRectangle(0, 560, 1920, 520, {230, 230, 210});
+    float const sizes[] = {14.0f, 23.5f, 48.0f, 96.0f, 200.0f};
+    int y = 60;
+    for (float const size : sizes) {
+        y += int(size) + 10;
+        scene->DrawSdfText("Distance fields", renderer.font, 40, y, size, {});
+    }
+    SdfTextStyle style;
+    style.color = {250, 200, 60};
+    style.outlineWidth = 3.0f;
+    style.outlineColor = {40, 20, 0};
+    style.glowRadius = 10.0f;
+    style.glowColor = {255, 120, 0, 160};
+    style.shadowX = 8;
+    style.shadowY = 10;
+    style.shadowSoftness = 6.0f;
+    style.shadowColor = {0, 0, 0, 140};
+    scene->DrawSdfText("Outline, glow\nand shadow", renderer.font, 40, 720, 110.0f, style);
+}
+
+static void ScaledBlitScene(Renderer& renderer, const Image& image) {
+    ImageFilter const filters[] = {ImageFilter::Nearest, ImageFilter::Bilinear, ImageFilter::Box};
+    for (int f = 0; f < 3; f++) {
+        int const x = 20 + f * 640;
+        // Up by a non-integer factor, down to about a third, and flipped in aspect
+        renderer.DrawImageScaled(image, x, 20, 377, 283, filters[f]);
+        renderer.DrawImageScaled(image, x + 400, 20, 53, 41, filters[f], BlendMode::SrcOver);
+        renderer.DrawImageScaled(image, x + 400, 100, 90, 200, filters[f]);
+        // Part of the image, zoomed in, and a rect hanging off the bottom of the screen
+        renderer.DrawImageRect(image, Rect::FromSize(30, 20, 40, 30),
+                               Rect::FromSize(x, 340, 600, 450), filters[f], BlendMode::SrcOver);
+        renderer.DrawImageScaled(image, x + 100, 850, 500, 400, filters[f]);
+    }
+}
+
+// Recorded with sort keys out of order, so the sorted list draws the key 0 panels underneath.
+// Static, since tiled rendering reads the list until Flush.
+static void SortedListScene(Renderer& renderer, const Image& image) {
+    static DisplayList list;
+    list.Clear();
+    for (int i = 0; i < 8; i++) {
+        list.SetSortKey(1);
+        list.FillRect(Rect::FromSize(100 + i * 200, 300, 120, 120), {u8(i * 30), 200, 80});
+        list.DrawImage(image, 150 + i * 200, 350);
+        list.SetSortKey(0);
+        list.FillRect(Rect::FromSize(60 + i * 200, 260, 220, 260), {40, 40, u8(100 + i * 15)});
+    }
+    list.Sort();
+    renderer.scene->Execute(list);
+}
+
+static const GoldenScene Scenes[] = {
+    {"rects", RectsScene},
+    {"blit", BlitScene},
+    {"text", TextScene},
+    {"blend", BlendScene},
+    {"stroke", StrokeScene},
+    {"shapes", ShapesScene},
+    {"sdf_text", SdfTextScene},
+    {"scaled_blit", ScaledBlitScene},
+    {"sorted_list", SortedListScene},
+};
+
+// FNV-1a over the whole frame buffer
+static u64 HashFrame(const Scene2D* scene) {
+    auto const* bytes =
+        reinterpret_cast<const u8*>(scene->frameBuffers[scene->activeFrameBufferIdx]);
+    size_t const size = size_t(scene->width) * scene->height * 4;
+    u64 hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static bool WritePpm(const Scene2D* scene, const std::string& path) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        LOG_ERROR("Failed to open {} for writing", path);
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", scene->width, scene->height);
+    auto const* pixels =
+        reinterpret_cast<const u32*>(scene->frameBuffers[scene->activeFrameBufferIdx]);
+    std::vector<u8> row(scene->width * 3);
+    for (int y = 0; y < scene->height; y++) {
+        for (int x = 0; x < scene->width; x++) {
+            u32 const pixel = pixels[y * scene->width + x];
+            row[x * 3] = u8(pixel >> 16);
+            row[x * 3 + 1] = u8(pixel >> 8);
+            row[x * 3 + 2] = u8(pixel);
+        }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    fclose(file);
+    return true;
+}
+
+// Lines of "<scene> <hash>"; blank lines and lines starting with '#' are skipped
+static bool ReadReferences(const std::string& path, std::map<std::string, u64>& references) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) {
+        LOG_ERROR("Failed to open references {}", path);
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        char name[128];
+        unsigned long long hash = 0;
+        if (line[0] != '#' && sscanf(line, "%127s %llx", name, &hash) == 2) {
+            references[name] = hash;
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+static bool WriteReferences(const std::string& path, const std::map<std::string, u64>& hashes) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        LOG_ERROR("Failed to open {} for writing", path);
+        return false;
+    }
+    fprintf(file, "# Frame hashes checked by src/host/golden.cpp, regenerate with --update\n");
+    for (const GoldenScene& scene : Scenes) {
+        fprintf(file, "%s %016llx\n", scene.name,
+                static_cast<unsigned long long>(hashes.at(scene.name)));
+    }
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::string referencePath;
+    std::string dumpDir;
+    bool update = false;
+    for (int i = 1; i < argc; i++) {
+        std::string const arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else if (arg == "--dump" && i + 1 < argc) {
+            dumpDir = argv[++i];
+        } else if (referencePath.empty() && arg[0] != '-') {
+            referencePath = arg;
+        } else {
+            LOG_ERROR("Unknown option {}", arg);
+            return 2;
+        }
+    }
+    if (referencePath.empty()) {
+        LOG_ERROR("usage: golden <golden.txt> [--update] [--dump <dir>]");
+        return 2;
+    }
+
+    std::map<std::string, u64> references;
+    if (!update && !ReadReferences(referencePath, references)) {
+        return 2;
+    }
+
+    // Translucent, with every channel varying, so blending and filtering show up in the hashes
+    Image image{};
+    image.Allocate(160, 120);
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+            u32 const alpha = (x + y) * 255 / (image.width + image.height - 2);
+            image.pixels[y * image.stride + x] =
+                (alpha << 24) | ((x * 8 & 0xFF) << 16) | ((y * 2) << 8) | ((x ^ y) & 0xFF);
+        }
+    }
+
+    Renderer immediate{};
+    Renderer tiled{};
+    tiled.scene->SetTiledRendering(3);
+
+    std::map<std::string, u64> hashes;
+    int failures = 0;
+    for (const GoldenScene& scene : Scenes) {
+        u64 hash[2]{};
+        int mode = 0;
+        for (Renderer* renderer : {&immediate, &tiled}) {
+            renderer->BeginFrame();
+            scene.draw(*renderer, image);
+            renderer->scene->Flush();
+            hash[mode] = HashFrame(renderer->scene);
+            if (!dumpDir.empty() && mode == 0) {
+                WritePpm(renderer->scene, fmt::format("{}/{}.ppm", dumpDir, scene.name));
+            }
+            renderer->EndFrame();
+            mode++;
+        }
+        hashes[scene.name] = hash[0];
+
+        bool passed = hash[0] == hash[1];
+        if (!passed) {
+            LOG_RAW("FAIL {}: tiled rendering {:016x} differs from immediate {:016x}\n",
+                    scene.name, hash[1], hash[0]);
+        }
+        if (!update) {
+            auto const reference = references.find(scene.name);
+            if (reference == references.end()) {
+                LOG_RAW("FAIL {}: no reference hash\n", scene.name);
+                passed = false;
+            } else if (reference->second != hash[0]) {
+                LOG_RAW("FAIL {}: {:016x}, expected {:016x}\n", scene.name, hash[0],
+                        reference->second);
+                passed = false;
+            }
+        }
+        if (passed) {
+            LOG_RAW("ok   {}\n", scene.name);
+        } else {
+            failures++;
+        }
+    }
+
+    if (update) {
+        if (failures != 0) {
+            LOG_ERROR("Not updating {}, tiled and immediate rendering disagree", referencePath);
+            return 1;
+        }
+        return WriteReferences(referencePath, hashes) ? 0 : 2;
+    }
+    LOG_RAW("{} of {} scenes failed\n", failures, std::size(Scenes));
+    return failures == 0 ? 0 : 1;
+}
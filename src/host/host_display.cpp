@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <thread>
+
+#include "host/host_display.h"
+#include "logging.h"
+
+DisplayBackend* CreateDisplayBackend() {
+    return new HostDisplayBackend(HostDisplayConfig::FromEnvironment());
+}
+
+HostDisplayConfig HostDisplayConfig::FromEnvironment() {
+    HostDisplayConfig config{};
+    if (const char* vsync = getenv("HOST_VSYNC")) {
+        config.realtime = atoi(vsync) != 0;
+    }
+    if (const char* rate = getenv("HOST_REFRESH_RATE")) {
+        config.refreshRate = atof(rate);
+    }
+    if (const char* dir = getenv("HOST_DUMP_DIR")) {
+        config.dumpDir = dir;
+    }
+    return config;
+}
+
+HostDisplayBackend::HostDisplayBackend(HostDisplayConfig config) : config(std::move(config)) {}
+
+HostDisplayBackend::~HostDisplayBackend() {
+    DeallocateVideoMem();
+}
+
+bool HostDisplayBackend::Open() {
+    if (config.refreshRate <= 0.0) {
+        LOG_ERROR("Invalid refresh rate: {}", config.refreshRate);
+        return false;
+    }
+    vsyncInterval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / config.refreshRate));
+    vsyncOrigin = Clock::now();
+    frameStart = vsyncOrigin;
+    return true;
+}
+
+void* HostDisplayBackend::AllocateVideoMem(size_t size, int alignment) {
+    size = (size + alignment - 1) / alignment * alignment;
+    videoMem = aligned_alloc(alignment, size);
+    return videoMem;
+}
+
+void HostDisplayBackend::DeallocateVideoMem() {
+    free(videoMem);
+    videoMem = nullptr;
+    buffers.clear();
+}
+
+bool HostDisplayBackend::RegisterBuffers(char** buffers, int num, int width, int height) {
+    this->buffers.assign(buffers, buffers + num);
+    this->width = width;
+    this->height = height;
+    return true;
+}
+
+void HostDisplayBackend::UnregisterBuffers() {
+    buffers.clear();
+}
+
+bool HostDisplayBackend::SubmitFlip(int index, s64 flipArg) {
+    if (index != BlankBuffer && !config.dumpDir.empty()) {
+        DumpFrame(index, fmt::format("{}/frame_{:05}.ppm", config.dumpDir, flipArg));
+    }
+    return true;
+}
+
+void HostDisplayBackend::WaitFlip(s64 /*flipArg*/) {
+    auto const now = Clock::now();
+
+    // A frame that took longer than one refresh interval to produce missed a vsync for every
+    // whole interval it ran over
+    missed += (now - frameStart) / vsyncInterval;
+
+    if (config.realtime) {
+        auto const vsyncs = (now - vsyncOrigin) / vsyncInterval + 1;
+        std::this_thread::sleep_until(vsyncOrigin + vsyncs * vsyncInterval);
+    }
+
+    frameStart = Clock::now();
+    presented++;
+}
+
+bool HostDisplayBackend::DumpFrame(int index, const std::string& path) const {
+    if (index < 0 || index >= (int)buffers.size()) {
+        return false;
+    }
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        LOG_ERROR("Failed to open {} for writing", path);
+        return false;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::vector<u8> row(width * 3);
+    auto const* pixels = reinterpret_cast<const u32*>(buffers[index]);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            u32 const pixel = pixels[y * width + x];
+            row[x * 3 + 0] = (pixel >> 16) & 0xFF;
+            row[x * 3 + 1] = (pixel >> 8) & 0xFF;
+            row[x * 3 + 2] = pixel & 0xFF;
+        }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    fclose(file);
+    return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "display_backend.h"
+
+struct HostDisplayConfig {
+    // Sleep until each simulated vsync like a real flip would; off by default so profiling runs
+    // aren't throttled to the refresh rate.
+    bool realtime = false;
+    double refreshRate = 60.0;
+    // When set, every submitted frame is written to this directory as frame_NNNNN.ppm
+    std::string dumpDir;
+
+    // Reads HOST_VSYNC=1, HOST_REFRESH_RATE and HOST_DUMP_DIR
+    static HostDisplayConfig FromEnvironment();
+};
+
+// Display backend for HOST_BUILD: frame buffers live in plain host memory and vsync is simulated
+// against the wall clock.
+class HostDisplayBackend : public DisplayBackend {
+public:
+    explicit HostDisplayBackend(HostDisplayConfig config = {});
+    ~HostDisplayBackend() override;
+
+    bool Open() override;
+
+    void* AllocateVideoMem(size_t size, int alignment) override;
+    void DeallocateVideoMem() override;
+
+    bool RegisterBuffers(char** buffers, int num, int width, int height) override;
+    void UnregisterBuffers() override;
+
+    bool SubmitFlip(int index, s64 flipArg) override;
+    void WaitFlip(s64 flipArg) override;
+
+    // Writes buffer `index` as a binary PPM
+    bool DumpFrame(int index, const std::string& path) const;
+
+    u64 PresentedFrames() const { return presented; }
+    // Vsyncs that passed without a new frame being ready
+    u64 MissedVsyncs() const { return missed; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    HostDisplayConfig config;
+
+    void* videoMem{};
+    std::vector<char*> buffers;
+    int width{};
+    int height{};
+
+    Clock::duration vsyncInterval{};
+    Clock::time_point vsyncOrigin{};
+    Clock::time_point frameStart{};
+
+    u64 presented{};
+    u64 missed{};
+};
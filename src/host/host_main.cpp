@@ -0,0 +1,63 @@
+#include <stdlib.h>
+
+#include <chrono>
+
+#include "glyph_cache.h"
+#include "image_pool.h"
+#include "logging.h"
+#include "renderer.h"
+
+// Native stand-in for App: renders a fixed scene for a number of frames and reports the average
+// frame time. Combine with HOST_DUMP_DIR to capture the frames for inspection.
+//
+//   host_demo [frames] [tiled rendering threads] [frame buffers]
+int main(int argc, char** argv) {
+    int const frames = argc > 1 ? atoi(argv[1]) : 600;
+    int const threads = argc > 2 ? atoi(argv[2]) : 0;
+    int const frameBuffers = argc > 3 ? atoi(argv[3]) : Renderer::DefaultFrameBuffers;
+
+    Renderer renderer{FontLoading::Immediate, frameBuffers};
+    renderer.scene->SetTiledRendering(threads);
+
+    Image image{};
+    image.Allocate(256, 256);
+    for (int y = 0; y < image.height; y++) {
+        for (int x = 0; x < image.width; x++) {
+            image.pixels[y * image.stride + x] = 0x80000000u | (x << 16) | (y << 8) | 0x80;
+        }
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        renderer.BeginFrame();
+        renderer.scene->DrawRectangle(100, 100, 200, 200, {0, 0, 0});
+        renderer.scene->DrawRectangle(120, 120, 160, 160, {255, 128, 128});
+        renderer.scene->DrawRectangle(140, 140, 120, 120, {0, 0, 0});
+        renderer.scene->DrawText("Hello, Screen!", renderer.font, 400, 220, {50, 50, 50},
+                                 {0, 0, 255});
+        renderer.DrawImage(image, 1600 - i % 400, 700);
+        renderer.EndFrame();
+    }
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    double const ms = std::chrono::duration<double, std::milli>(elapsed).count();
+    LOG_INFO("{} frames, {:.3f} ms/frame", frames, ms / frames);
+#ifdef _DEBUG
+    LOG_INFO("Heap allocations in the last frame: {}", renderer.FrameHeapAllocations());
+#endif
+
+    GlyphCacheStats const glyphs = GlyphCache::Shared().Stats();
+    LOG_INFO("Glyph cache: {} hits, {} misses, {} glyphs in {} pages ({} KiB)", glyphs.hits,
+             glyphs.misses, glyphs.glyphs, glyphs.pages, glyphs.bytes / 1024);
+    ImagePoolStats const images = ImagePool::Shared().Stats();
+    LOG_INFO("Image pool: {} KiB in use (peak {} KiB) of {} KiB reserved in {} regions, {} "
+             "allocations, {} from the kernel, {:.1f}% fragmentation",
+             images.inUse / 1024, images.peakInUse / 1024, images.reserved / 1024, images.regions,
+             images.allocations, images.kernelAllocations, images.fragmentation * 100.0f);
+    VideoMemoryStats const video = renderer.scene->VideoMemory().Stats();
+    LOG_INFO("Video memory: {} KiB in use ({} KiB frame buffers) of {} KiB, largest free block "
+             "{} KiB",
+             video.inUse / 1024, video.inUseByTag[int(VideoMemoryTag::FrameBuffer)] / 1024,
+             video.size / 1024, video.largestFree / 1024);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in for libSceSysmodule; every module is linked in natively, so loading always
+// succeeds.
+
+#define ORBIS_SYSMODULE_FREETYPE_OL 0x009A
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int sceSysmoduleLoadModule(unsigned short id);
+
+#ifdef __cplusplus
+}
+#endif
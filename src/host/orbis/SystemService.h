@@ -0,0 +1,13 @@
+#pragma once
+
+// Host stand-in for libSceSystemService; LoadExec terminates the process.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int sceSystemServiceLoadExec(const char* path, char* const argv[]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,9 @@
+#pragma once
+
+// Host stand-in for the libSceUserService types referenced by shared headers.
+
+#include <stdint.h>
+
+typedef int32_t OrbisUserServiceUserId;
+
+#define ORBIS_USER_SERVICE_USER_ID_SYSTEM 255
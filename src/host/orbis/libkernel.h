@@ -0,0 +1,33 @@
+#pragma once
+
+// Host stand-in for the subset of libkernel the shared renderer code uses. Direct memory is backed
+// by plain aligned host allocations, debug output goes to stderr.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#define ORBIS_OK 0
+#define ORBIS_FAIL -1
+
+#define ORBIS_KERNEL_WB_ONION 0
+#define ORBIS_KERNEL_WC_GARLIC 3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int sceKernelDebugOutText(int channel, const char* text);
+const char* sceKernelGetFsSandboxRandomWord();
+int sceKernelUsleep(unsigned int microseconds);
+
+size_t sceKernelGetDirectMemorySize();
+int sceKernelAllocateDirectMemory(off_t searchStart, off_t searchEnd, size_t len, size_t alignment,
+                                  int memoryType, off_t* physAddrOut);
+int sceKernelMapDirectMemory(void** addr, size_t len, int prot, int flags, off_t directMemoryStart,
+                             size_t alignment);
+int sceKernelReleaseDirectMemory(off_t start, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,67 @@
+#include <orbis/Sysmodule.h>
+#include <orbis/SystemService.h>
+#include <orbis/libkernel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Host implementations of the SDK functions declared by the stand-in headers in src/host.
+
+extern "C" {
+
+int sceKernelDebugOutText(int /*channel*/, const char* text) {
+    fputs(text, stderr);
+    return ORBIS_OK;
+}
+
+const char* sceKernelGetFsSandboxRandomWord() {
+    return "host";
+}
+
+int sceKernelUsleep(unsigned int microseconds) {
+    return usleep(microseconds);
+}
+
+size_t sceKernelGetDirectMemorySize() {
+    return size_t(5) << 30;
+}
+
+// "Physical" addresses are simply the host pointers, so mapping is the identity.
+int sceKernelAllocateDirectMemory(off_t /*searchStart*/, off_t /*searchEnd*/, size_t len,
+                                  size_t alignment, int /*memoryType*/, off_t* physAddrOut) {
+    if (alignment < sizeof(void*)) {
+        alignment = sizeof(void*);
+    }
+    void* mem = aligned_alloc(alignment, (len + alignment - 1) / alignment * alignment);
+    if (!mem) {
+        return ORBIS_FAIL;
+    }
+    *physAddrOut = (off_t)mem;
+    return ORBIS_OK;
+}
+
+int sceKernelMapDirectMemory(void** addr, size_t /*len*/, int /*prot*/, int /*flags*/,
+                             off_t directMemoryStart, size_t /*alignment*/) {
+    *addr = (void*)directMemoryStart;
+    return ORBIS_OK;
+}
+
+int sceKernelReleaseDirectMemory(off_t start, size_t /*len*/) {
+    free((void*)start);
+    return ORBIS_OK;
+}
+
+int sceSysmoduleLoadModule(unsigned short /*id*/) {
+    return ORBIS_OK;
+}
+
+void sceSysUtilSendSystemNotificationWithText(int /*type*/, const char* message) {
+    fprintf(stderr, "[Notification] %s\n", message);
+}
+
+int sceSystemServiceLoadExec(const char* /*path*/, char* const /*argv*/[]) {
+    fflush(stderr);
+    exit(EXIT_FAILURE);
+}
+
+} // extern "C"
@@ -0,0 +1,5 @@
+#pragma once
+
+// Host stand-in for the OpenOrbis proto-include.h, which pulls in FreeType.
+#include <ft2build.h>
+#include FT_FREETYPE_H
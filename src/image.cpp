@@ -1,38 +1,4 @@
-#include "assert.h"
 #include "image.h"
-#include "orbis/libkernel.h"
-#include "types.h"
-
-enum MemoryProt : u32 {
-    NoAccess = 0,
-    CpuRead = 1,
-    CpuWrite = 2,
-    CpuReadWrite = 3,
-    CpuExec = 4,
-    GpuRead = 16,
-    GpuWrite = 32,
-    GpuReadWrite = 48,
-};
-template <typename T>
-[[nodiscard]] constexpr T AlignUp(T value, std::size_t size) {
-    static_assert(std::is_unsigned_v<T>, "T must be an unsigned value.");
-    auto mod{static_cast<T>(value % size)};
-    value -= mod;
-    return static_cast<T>(mod == T{0} ? value : value + size);
-}
-static VAddr alloc_memory(size_t size, size_t alignment, u32 memType, u32 prot, u64& out_dmem_off) {
-    size = AlignUp(size, 16_KB);
-    ASSERT(alignment == AlignUp(alignment, 16_KB));
-
-    off_t phys = 0;
-    ASSERT_OK(sceKernelAllocateDirectMemory(0, sceKernelGetDirectMemorySize(), size, alignment,
-                                            memType, &phys));
-
-    void* virt = nullptr;
-    ASSERT_OK(sceKernelMapDirectMemory(&virt, size, prot, 0, phys, alignment));
-
-    return VAddr(virt);
-}
 
 Image::~Image() {
     Free();
@@ -50,53 +16,47 @@ Image& Image::operator=(Image&& other) noexcept {
         height = other.height;
         stride = other.stride;
 
-        size = other.size;
-        alignedSize = other.alignedSize;
-
         pixels = other.pixels;
-        directMemOff = other.directMemOff;
+        block = other.block;
 
         other.width = 0;
         other.height = 0;
         other.stride = 0;
-        other.size = 0;
-        other.alignedSize = 0;
         other.pixels = nullptr;
-        other.directMemOff = 0;
+        other.block = {};
     }
     return *this;
 }
 
 bool Image::Allocate(int w, int h) {
     Free();
+    if (w <= 0 || h <= 0) {
+        return false;
+    }
 
-    width = w;
-    height = h;
-    stride = w; // for now, no padding
-
-    size = (size_t)width * height * sizeof(uint32_t);
+    constexpr int rowPixels = RowAlignment / sizeof(uint32_t);
+    int const paddedStride = (w + rowPixels - 1) / rowPixels * rowPixels;
 
-    pixels = reinterpret_cast<u32*>(alloc_memory(size, 0, ORBIS_KERNEL_WB_ONION,
-                                                 MemoryProt::CpuReadWrite | MemoryProt::GpuRead,
-                                                 directMemOff));
+    block = ImagePool::Shared().Allocate(size_t(paddedStride) * h * sizeof(uint32_t));
+    if (!block.memory) {
+        block = {};
+        return false;
+    }
 
+    width = w;
+    height = h;
+    stride = paddedStride;
+    pixels = static_cast<uint32_t*>(block.memory);
     return true;
 }
 
 void Image::Free() {
-    if (pixels) {
-        // unmap is implicit on release for this usage pattern
-        pixels = nullptr;
-    }
-
-    if (directMemOff) {
-        sceKernelReleaseDirectMemory(directMemOff, alignedSize);
-        directMemOff = 0;
-    }
+    // Back to the pool, which keeps small blocks for reuse and releases big ones
+    ImagePool::Shared().Free(block);
+    block = {};
+    pixels = nullptr;
 
     width = 0;
     height = 0;
     stride = 0;
-    size = 0;
-    alignedSize = 0;
 }
\ No newline at end of file
@@ -3,6 +3,38 @@
 #include <vector>
 #include <types.h>
 
+#include "image_pool.h"
+#include "rect.h"
+
+// A rectangle of 32bpp pixels in memory owned by something else: an Image, part of one, or any
+// other buffer with rows `stride` pixels apart. Views are cheap to copy and slice, and stay valid
+// as long as the memory they point into.
+struct ImageView {
+    uint32_t* pixels{};
+    int width{};
+    int height{};
+    int stride{}; // in pixels
+
+    bool Empty() const {
+        return pixels == nullptr || width <= 0 || height <= 0;
+    }
+    uint32_t* Row(int y) const {
+        return pixels + size_t(y) * stride;
+    }
+
+    // The part of the view inside `rect`, given in the view's coordinates and clipped to it
+    ImageView Sub(Rect rect) const {
+        rect = rect.Intersect({0, 0, width, height});
+        if (rect.Empty()) {
+            return {};
+        }
+        return {Row(rect.y0) + rect.x0, rect.Width(), rect.Height(), stride};
+    }
+    ImageView Sub(int x, int y, int w, int h) const {
+        return Sub(Rect::FromSize(x, y, w, h));
+    }
+};
+
 class Image {
 public:
     Image() = default;
@@ -16,17 +48,28 @@ public:
     Image(Image&& other) noexcept;
     Image& operator=(Image&& other) noexcept;
 
+    // Rows start this many bytes apart at minimum, so every row is as aligned as the first one
+    // (at least ImagePool::MinBlock aligned) for cache lines and vector loads
+    static constexpr int RowAlignment = 64;
+
+    // Rows are padded to RowAlignment: stride may be larger than w. The pixels come from
+    // ImagePool::Shared(); returns false, leaving the image empty, if it is out of memory or the
+    // size isn't positive.
     bool Allocate(int w, int h);
     void Free();
 
+    ImageView View() const {
+        return {pixels, width, height, stride};
+    }
+    operator ImageView() const {
+        return View();
+    }
+
     int width{};
     int height{};
     int stride{};
 
-    uint32_t* pixels{};         // mapped pointer
+    uint32_t* pixels{}; // mapped pointer
 private:
-    size_t size{};              // requested size
-    size_t alignedSize{};       // actual allocated size
-
-    u64 directMemOff{};       // handle for freeing
-};
\ No newline at end of file
+    ImagePool::Block block{}; // where the pixels came from, for freeing
+};
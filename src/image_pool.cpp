@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#include "image_pool.h"
+#include "logging.h"
+#include "orbis/libkernel.h"
+
+enum MemoryProt : u32 {
+    NoAccess = 0,
+    CpuRead = 1,
+    CpuWrite = 2,
+    CpuReadWrite = 3,
+    CpuExec = 4,
+    GpuRead = 16,
+    GpuWrite = 32,
+    GpuReadWrite = 48,
+};
+template <typename T>
+[[nodiscard]] constexpr T AlignUp(T value, std::size_t size) {
+    static_assert(std::is_unsigned_v<T>, "T must be an unsigned value.");
+    auto mod{static_cast<T>(value % size)};
+    value -= mod;
+    return static_cast<T>(mod == T{0} ? value : value + size);
+}
+
+// Direct memory is allocated and mapped in 16 KiB pages
+static constexpr size_t PageSize = 16_KB;
+
+// Allocates and maps `size` bytes of direct memory, rounded up to whole pages. Returns null if
+// there is not enough.
+static void* MapDirectMemory(size_t& size, off_t& directMemOff) {
+    size = AlignUp(size, PageSize);
+
+    off_t phys = 0;
+    if (sceKernelAllocateDirectMemory(0, sceKernelGetDirectMemorySize(), size, PageSize,
+                                      ORBIS_KERNEL_WB_ONION, &phys) != ORBIS_OK) {
+        return nullptr;
+    }
+
+    void* virt = nullptr;
+    if (sceKernelMapDirectMemory(&virt, size, MemoryProt::CpuReadWrite | MemoryProt::GpuRead, 0,
+                                 phys, PageSize) != ORBIS_OK) {
+        sceKernelReleaseDirectMemory(phys, size);
+        return nullptr;
+    }
+
+    directMemOff = phys;
+    return virt;
+}
+
+// The smallest class whose blocks hold `bytes`, for bytes up to MaxBlock
+static int SizeClass(size_t bytes) {
+    return std::bit_width((std::max(bytes, ImagePool::MinBlock) - 1) / ImagePool::MinBlock);
+}
+
+ImagePool& ImagePool::Shared() {
+    static ImagePool pool;
+    return pool;
+}
+
+ImagePool::ImagePool(size_t regionSize) : regionSize(AlignUp(regionSize, PageSize)) {}
+
+ImagePool::~ImagePool() {
+    for (const Region& region : this->regions) {
+        sceKernelReleaseDirectMemory(region.directMemOff, this->regionSize);
+    }
+}
+
+ImagePool::Block ImagePool::Allocate(size_t bytes) {
+    std::lock_guard lock(this->mutex);
+
+    Block block{nullptr, bytes, -1, 0};
+    if (bytes > MaxBlock) {
+        size_t size = bytes;
+        block.memory = MapDirectMemory(size, block.directMemOff);
+        if (!block.memory) {
+            LOG_ERROR("Out of direct memory for a {} KiB image", bytes / 1_KB);
+            return block;
+        }
+        this->ownBytes += size;
+        this->kernelAllocations++;
+    } else {
+        int const sizeClass = SizeClass(bytes);
+        size_t const size = MinBlock << sizeClass;
+        std::vector<void*>& freeList = this->freeLists[sizeClass];
+        if (!freeList.empty()) {
+            block.memory = freeList.back();
+            freeList.pop_back();
+            this->freeBytes -= size;
+        } else if (!(block.memory = carve(size))) {
+            return block;
+        }
+        block.sizeClass = sizeClass;
+    }
+
+    this->allocations++;
+    this->inUse += bytes;
+    this->peakInUse = std::max(this->peakInUse, this->inUse);
+    return block;
+}
+
+void ImagePool::Free(const Block& block) {
+    if (!block.memory) {
+        return;
+    }
+
+    std::lock_guard lock(this->mutex);
+    this->inUse -= block.size;
+    if (block.sizeClass < 0) {
+        size_t const size = AlignUp(block.size, PageSize);
+        sceKernelReleaseDirectMemory(block.directMemOff, size);
+        this->ownBytes -= size;
+    } else {
+        this->freeLists[block.sizeClass].push_back(block.memory);
+        this->freeBytes += MinBlock << block.sizeClass;
+    }
+}
+
+// Blocks are carved in order from the last region. What is left at the end of a region when a
+// block no longer fits stays unused.
+uint8_t* ImagePool::carve(size_t size) {
+    if (this->regions.empty() || this->regions.back().used + size > this->regionSize) {
+        Region region{nullptr, 0, 0};
+        size_t mapped = this->regionSize;
+        region.memory = static_cast<uint8_t*>(MapDirectMemory(mapped, region.directMemOff));
+        if (!region.memory) {
+            LOG_ERROR("Out of direct memory for a {} MiB image region", this->regionSize / 1_MB);
+            return nullptr;
+        }
+        this->regions.push_back(region);
+        this->kernelAllocations++;
+    }
+
+    Region& region = this->regions.back();
+    uint8_t* const memory = region.memory + region.used;
+    region.used += size;
+    this->carved += size;
+    return memory;
+}
+
+ImagePoolStats ImagePool::Stats() const {
+    std::lock_guard lock(this->mutex);
+
+    ImagePoolStats stats{};
+    stats.reserved = this->regions.size() * this->regionSize + this->ownBytes;
+    stats.inUse = this->inUse;
+    stats.peakInUse = this->peakInUse;
+    stats.free = this->freeBytes;
+    stats.regions = this->regions.size();
+    stats.allocations = this->allocations;
+    stats.kernelAllocations = this->kernelAllocations;
+    size_t const handedOut = this->carved + this->ownBytes;
+    stats.fragmentation = handedOut ? 1.0f - float(this->inUse) / float(handedOut) : 0.0f;
+    return stats;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <mutex>
+#include <vector>
+
+#include "types.h"
+
+struct ImagePoolStats {
+    size_t reserved; // mapped from the kernel: regions plus blocks of their own
+    size_t inUse;    // asked for by live allocations
+    size_t peakInUse;
+    size_t free; // in blocks waiting on the free lists
+    size_t regions;
+    u64 allocations;
+    u64 kernelAllocations; // direct memory allocations made, for regions and big blocks
+    // Share of the memory handed out as blocks, live or freed, that holds no image data: freed
+    // blocks plus the rounding of each allocation up to its size class
+    float fragmentation;
+};
+
+// ImagePool hands out CPU-writable, GPU-readable direct memory for images. Rather than making a
+// kernel allocation and mapping per image, rounded up to 16 KiB, it maps large regions and carves
+// them into blocks of power-of-two size classes from MinBlock to MaxBlock. Freed blocks go on
+// their class's free list for the next allocation of that class. Allocations bigger than MaxBlock
+// (full-screen images, camera frames) get direct memory of their own, released when they are
+// freed. Regions are kept for the life of the pool.
+//
+// On the host the kernel calls are the stand-ins in src/host, backed by the C heap.
+class ImagePool {
+public:
+    static constexpr size_t MinBlock = 1_KB;
+    static constexpr size_t MaxBlock = 1_MB;
+    static constexpr size_t DefaultRegionSize = 16_MB;
+
+    struct Block {
+        void* memory;
+        size_t size;        // what was asked for
+        int sizeClass;      // -1 for a block with direct memory of its own
+        off_t directMemOff; // of that memory
+    };
+
+    // The pool Image allocates from
+    static ImagePool& Shared();
+
+    explicit ImagePool(size_t regionSize = DefaultRegionSize);
+    ~ImagePool();
+
+    ImagePool(const ImagePool&) = delete;
+    ImagePool& operator=(const ImagePool&) = delete;
+
+    // Returns a block of at least `bytes`, aligned to MinBlock or more, or one with null `memory`
+    // if direct memory ran out
+    Block Allocate(size_t bytes);
+    void Free(const Block& block);
+
+    ImagePoolStats Stats() const;
+
+private:
+    static constexpr int ClassCount = 11; // MinBlock << 10 == MaxBlock
+
+    struct Region {
+        uint8_t* memory;
+        off_t directMemOff;
+        size_t used;
+    };
+
+    uint8_t* carve(size_t size);
+
+    mutable std::mutex mutex;
+    size_t regionSize;
+    std::vector<Region> regions;
+    std::vector<void*> freeLists[ClassCount];
+
+    size_t inUse{};
+    size_t peakInUse{};
+    size_t carved{}; // of regions, handed out as blocks
+    size_t freeBytes{};
+    size_t ownBytes{}; // blocks with direct memory of their own
+    u64 allocations{};
+    u64 kernelAllocations{};
+};
@@ -0,0 +1,182 @@
+#include <emmintrin.h>
+
+#include <algorithm>
+
+#include "image_scale.h"
+
+// Destination pixels are filtered this many at a time into a row buffer, then drawn with BlendRow
+static constexpr int Chunk = 256;
+
+// Where the center of destination pixel `i`, counted from the destination rectangle's edge,
+// falls in the source, in 16.16 fixed point from the source rectangle's edge
+static inline int64_t SourceCenter(int i, int64_t step) {
+    return i * step + step / 2;
+}
+
+// The two source pixels around a center for bilinear filtering, as offsets into the source
+// rectangle clamped to it, and the second one's 8-bit weight
+static inline void BilinearTaps(int64_t center, int size, int& first, int& second, int& weight) {
+    int64_t const position = center - 0x8000;
+    int const index = int(position >> 16);
+    first = std::clamp(index, 0, size - 1);
+    second = std::clamp(index + 1, 0, size - 1);
+    weight = int((position >> 8) & 0xFF);
+}
+
+// The source pixels a destination pixel covers, [first, last). Downscaled, neighboring boxes
+// share no source pixels and together cover all of them.
+static inline void BoxTaps(int i, int srcSize, int dstSize, int& first, int& last) {
+    first = int(int64_t(i) * srcSize / dstSize);
+    last = std::max(int(int64_t(i + 1) * srcSize / dstSize), first + 1);
+}
+
+static inline __m128i Unpack(uint32_t pixel) {
+    return _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(pixel)), _mm_setzero_si128());
+}
+
+// (a * (256 - w) + b * w) / 256 on 16-bit lanes holding bytes, with w in [0, 255]. The sum
+// stays below 65536, so unsigned 16-bit lanes hold it.
+static inline __m128i Lerp(__m128i a, __m128i b, __m128i w) {
+    __m128i const inv = _mm_sub_epi16(_mm_set1_epi16(256), w);
+    __m128i const sum = _mm_add_epi16(_mm_mullo_epi16(a, inv), _mm_mullo_epi16(b, w));
+    return _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(128)), 8);
+}
+
+// Bilinear filtering is done in two passes over 16-bit lanes, four per pixel: each source row is
+// filtered horizontally once, then pairs of filtered rows vertically for every destination row
+// between them. Both work on two pixels at a time; the tables hold an even number of entries.
+static void BilinearHorizontal(uint16_t* out, const uint32_t* row, const int* x0, const int* x1,
+                               const uint16_t* weights, int count) {
+    for (int i = 0; i < count; i += 2) {
+        __m128i const a = _mm_unpacklo_epi64(Unpack(row[x0[i]]), Unpack(row[x0[i + 1]]));
+        __m128i const b = _mm_unpacklo_epi64(Unpack(row[x1[i]]), Unpack(row[x1[i + 1]]));
+        __m128i const w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), Lerp(a, b, w));
+    }
+}
+
+static void BilinearVertical(uint32_t* out, const uint16_t* top, const uint16_t* bottom, int fy,
+                             int count) {
+    __m128i const w = _mm_set1_epi16(static_cast<short>(fy));
+    for (int i = 0; i < count; i += 2) {
+        __m128i const a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + i * 4));
+        __m128i const b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + i * 4));
+        __m128i const result = Lerp(a, b, w);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(result, result));
+    }
+}
+
+// Sums each box's pixels in 32-bit lanes and divides in float, rounding to nearest
+static void BoxRow(uint32_t* out, const uint32_t* src, int srcStride, int y0, int y1,
+                   const int* x0, const int* x1, int count) {
+    __m128i const zero = _mm_setzero_si128();
+    for (int i = 0; i < count; i++) {
+        __m128i sum = zero;
+        for (int y = y0; y < y1; y++) {
+            const uint32_t* row = src + size_t(y) * srcStride;
+            for (int x = x0[i]; x < x1[i]; x++) {
+                sum = _mm_add_epi32(sum, _mm_unpacklo_epi16(Unpack(row[x]), zero));
+            }
+        }
+        __m128 const scale = _mm_set1_ps(1.0f / float((y1 - y0) * (x1[i] - x0[i])));
+        __m128i const average = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sum), scale));
+        __m128i const packed = _mm_packs_epi32(average, average);
+        out[i] = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(packed, packed)));
+    }
+}
+
+void RasterScaledBlit(const RasterTarget& target, const uint32_t* src, int const srcStride,
+                      Rect const srcRect, Rect const dstRect, ImageFilter const filter,
+                      BlendMode const mode) {
+    Rect const clipped = dstRect.Intersect(target.clip);
+    if (clipped.Empty() || srcRect.Empty()) {
+        return;
+    }
+
+    int const srcW = srcRect.Width();
+    int const srcH = srcRect.Height();
+    int const dstW = dstRect.Width();
+    int const dstH = dstRect.Height();
+    int64_t const stepX = (int64_t(srcW) << 16) / dstW;
+    int64_t const stepY = (int64_t(srcH) << 16) / dstH;
+    // The source rectangle's top-left pixel, taps are relative to it
+    const uint32_t* const origin = src + size_t(srcRect.y0) * srcStride + srcRect.x0;
+
+    // Per column of the chunk: the source column (Nearest), the two taps and the weight repeated
+    // for each lane (Bilinear) or the box's columns (Box). An odd last column is repeated, so the
+    // bilinear passes can work in pairs.
+    int x0[Chunk + 1];
+    int x1[Chunk + 1];
+    alignas(16) uint16_t weights[(Chunk + 1) * 4];
+    alignas(16) uint32_t row[Chunk + 1];
+    // Two source rows filtered horizontally, and which rows they are
+    alignas(16) uint16_t filteredRows[2][(Chunk + 1) * 4];
+    uint16_t* filtered[2] = {filteredRows[0], filteredRows[1]};
+    int filteredRow[2];
+    for (int start = clipped.x0; start < clipped.x1; start += Chunk) {
+        int const count = std::min(Chunk, clipped.x1 - start);
+        for (int i = 0; i < count; i++) {
+            int const column = start + i - dstRect.x0;
+            switch (filter) {
+            case ImageFilter::Nearest:
+                x0[i] = std::min(int(SourceCenter(column, stepX) >> 16), srcW - 1);
+                break;
+            case ImageFilter::Bilinear: {
+                int weight;
+                BilinearTaps(SourceCenter(column, stepX), srcW, x0[i], x1[i], weight);
+                std::fill_n(weights + i * 4, 4, uint16_t(weight));
+                break;
+            }
+            case ImageFilter::Box:
+                BoxTaps(column, srcW, dstW, x0[i], x1[i]);
+                break;
+            }
+        }
+        if (count % 2 != 0) {
+            x0[count] = x0[count - 1];
+            x1[count] = x1[count - 1];
+            std::copy_n(weights + (count - 1) * 4, 4, weights + count * 4);
+        }
+        filteredRow[0] = filteredRow[1] = -1;
+
+        for (int py = clipped.y0; py < clipped.y1; py++) {
+            int const line = py - dstRect.y0;
+            switch (filter) {
+            case ImageFilter::Nearest: {
+                int const y = std::min(int(SourceCenter(line, stepY) >> 16), srcH - 1);
+                const uint32_t* srcRow = origin + size_t(y) * srcStride;
+                for (int i = 0; i < count; i++) {
+                    row[i] = srcRow[x0[i]];
+                }
+                break;
+            }
+            case ImageFilter::Bilinear: {
+                int y0, y1, fy;
+                BilinearTaps(SourceCenter(line, stepY), srcH, y0, y1, fy);
+                // Going down, the previous bottom row is often the new top one
+                if (filteredRow[0] != y0 && filteredRow[1] == y0) {
+                    std::swap(filtered[0], filtered[1]);
+                    std::swap(filteredRow[0], filteredRow[1]);
+                }
+                for (int k = 0; k < 2; k++) {
+                    int const y = k == 0 ? y0 : y1;
+                    if (filteredRow[k] != y) {
+                        BilinearHorizontal(filtered[k], origin + size_t(y) * srcStride, x0, x1,
+                                           weights, count);
+                        filteredRow[k] = y;
+                    }
+                }
+                BilinearVertical(row, filtered[0], filtered[1], fy, count);
+                break;
+            }
+            case ImageFilter::Box: {
+                int y0, y1;
+                BoxTaps(line, srcH, dstH, y0, y1);
+                BoxRow(row, origin, srcStride, y0, y1, x0, x1, count);
+                break;
+            }
+            }
+            BlendRow(target.pixels + size_t(py) * target.stride + start, row, count, mode);
+        }
+    }
+}
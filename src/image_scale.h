@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "blend.h"
+#include "raster.h"
+#include "rect.h"
+
+// How a scaled blit picks each destination pixel's color
+enum class ImageFilter : uint8_t {
+    Nearest,  // the source pixel under the pixel's center
+    Bilinear, // the four source pixels around the center, weighted by distance
+    Box,      // the average of every source pixel the destination pixel covers, for downscaling;
+              // upscaled, each destination pixel covers a single source pixel
+};
+
+// Draws the `srcRect` part of the image at `src` stretched over `dstRect`. Source coordinates are
+// stepped in 16.16 fixed point from each destination pixel's own position, so any split of the
+// draw by the clip gives the same pixels. Filters never read outside `srcRect`. Channels are
+// filtered independently, which for images with partial alpha is only exact if they are
+// premultiplied. The filtered rows are drawn with `mode` like RasterBlit's.
+void RasterScaledBlit(const RasterTarget& target, const uint32_t* src, int srcStride,
+                      Rect srcRect, Rect dstRect, ImageFilter filter, BlendMode mode);
@@ -5,38 +5,52 @@
 
 extern "C" void sceSysUtilSendSystemNotificationWithText(int type, const char* message);
 
+// Messages are formatted into a fmt::memory_buffer, which holds fmt::inline_buffer_size
+// characters on the stack, so logging only touches the heap for long messages
 template <typename... Args>
-std::string FormatLog(char const* format, Args const&... args) {
-    std::string message;
+void AppendLog(fmt::memory_buffer& buffer, char const* format, Args const&... args) {
     if constexpr (sizeof...(args) == 0) {
-        message = format;
+        buffer.append(std::string_view(format));
     } else {
-        message = fmt::vformat(format, fmt::make_format_args(args...));
+        fmt::vformat_to(fmt::appender(buffer), format, fmt::make_format_args(args...));
     }
-    return message;
+}
+
+template <typename... Args>
+std::string FormatLog(char const* format, Args const&... args) {
+    fmt::memory_buffer buffer;
+    AppendLog(buffer, format, args...);
+    return fmt::to_string(buffer);
 }
 
 template <typename... Args>
 void PrintLog(char const* log_level, char const* file, unsigned int line_num, char const* function,
               char const* format, Args const&... args) {
-    std::string message = FormatLog(format, args...);
-    std::string full_log =
-        fmt::format("[Homebrew] {}:{} <{}> {}: {}\n", file, line_num, log_level, function, message);
-    sceKernelDebugOutText(0, full_log.c_str());
+    fmt::memory_buffer buffer;
+    fmt::format_to(fmt::appender(buffer), "[Homebrew] {}:{} <{}> {}: ", file, line_num, log_level,
+                   function);
+    AppendLog(buffer, format, args...);
+    buffer.push_back('\n');
+    buffer.push_back('\0');
+    sceKernelDebugOutText(0, buffer.data());
 }
 
 template <typename... Args>
 void PrintLogN(char const* log_level, char const* file, unsigned int line_num, char const* function,
                char const* format, Args const&... args) {
     PrintLog(log_level, file, line_num, function, format, args...);
-    std::string message = FormatLog(format, args...);
-    sceSysUtilSendSystemNotificationWithText(222, message.c_str());
+    fmt::memory_buffer buffer;
+    AppendLog(buffer, format, args...);
+    buffer.push_back('\0');
+    sceSysUtilSendSystemNotificationWithText(222, buffer.data());
 }
 
 template <typename... Args>
 void PrintLogR(char const* format, Args const&... args) {
-    std::string message = FormatLog(format, args...);
-    sceKernelDebugOutText(0, message.c_str());
+    fmt::memory_buffer buffer;
+    AppendLog(buffer, format, args...);
+    buffer.push_back('\0');
+    sceKernelDebugOutText(0, buffer.data());
 }
 
 #define LOG_DEBUG(...) PrintLog("Debug", __FILE__, __LINE__, __func__, __VA_ARGS__)
@@ -0,0 +1,231 @@
+#include <emmintrin.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "raster.h"
+#include "stroke.h"
+
+// Spans at least this long are written with non-temporal stores, so large fills don't evict
+// everything else from the cache on their way to the frame buffer.
+static constexpr int kStreamingSpanThreshold = 1024;
+
+// The unaligned head is written pixel by pixel, the body 16 pixels per iteration with 128-bit
+// stores.
+void FillSpan(uint32_t* dst, uint32_t const value, int count) {
+    while (count > 0 && (reinterpret_cast<uintptr_t>(dst) & 15) != 0) {
+        *dst++ = value;
+        count--;
+    }
+
+    __m128i const v = _mm_set1_epi32(static_cast<int>(value));
+    bool const stream = count >= kStreamingSpanThreshold;
+    for (; count >= 16; count -= 16, dst += 16) {
+        auto* p = reinterpret_cast<__m128i*>(dst);
+        if (stream) {
+            _mm_stream_si128(p + 0, v);
+            _mm_stream_si128(p + 1, v);
+            _mm_stream_si128(p + 2, v);
+            _mm_stream_si128(p + 3, v);
+        } else {
+            _mm_store_si128(p + 0, v);
+            _mm_store_si128(p + 1, v);
+            _mm_store_si128(p + 2, v);
+            _mm_store_si128(p + 3, v);
+        }
+    }
+    for (; count >= 4; count -= 4, dst += 4) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+    while (count-- > 0) {
+        *dst++ = value;
+    }
+
+    if (stream) {
+        _mm_sfence();
+    }
+}
+
+// Blocks whose rows follow each other in both buffers (full-width images) are a single memcpy
+void CopyRows(uint32_t* dst, int dstStride, const uint32_t* src, int srcStride, int width,
+              int height) {
+    if (width == dstStride && width == srcStride) {
+        memcpy(dst, src, size_t(width) * height * sizeof(uint32_t));
+        return;
+    }
+    for (int row = 0; row < height; row++, dst += dstStride, src += srcStride) {
+        memcpy(dst, src, size_t(width) * sizeof(uint32_t));
+    }
+}
+
+static Color ScaleByCoverage(Color color, uint8_t coverage, BlendMode mode) {
+    auto const scale = [coverage](uint8_t value) {
+        return uint8_t((value * coverage + 127) / 255);
+    };
+    color.a = scale(color.a);
+    if (mode == BlendMode::PremulSrcOver) {
+        color.r = scale(color.r);
+        color.g = scale(color.g);
+        color.b = scale(color.b);
+    }
+    return color;
+}
+
+void FillCoverageSpan(uint32_t* dst, int count, uint8_t coverage, Color color, BlendMode mode) {
+    if (coverage != 255) {
+        color = ScaleByCoverage(color, coverage, mode);
+        if (mode == BlendMode::Replace) {
+            mode = BlendMode::SrcOver;
+        }
+    }
+
+    if (IsOpaqueBlend(color, mode)) {
+        FillSpan(dst, EncodeColor(color), count);
+    } else if (!IsNoOpBlend(color, mode)) {
+        BlendSpan(dst, color, count, mode);
+    }
+}
+
+static inline void WritePixel(uint32_t* dst, Color const color, BlendMode const mode) {
+    if (IsOpaqueBlend(color, mode)) {
+        *dst = EncodeColor(color);
+    } else {
+        *dst = BlendPixel(*dst, PackColor(color), mode);
+    }
+}
+
+void RasterPixel(const RasterTarget& target, int const x, int const y, Color const color,
+                 BlendMode const mode) {
+    const Rect& clip = target.clip;
+    if (x < clip.x0 || y < clip.y0 || x >= clip.x1 || y >= clip.y1) {
+        return;
+    }
+    WritePixel(target.pixels + y * target.stride + x, color, mode);
+}
+
+void RasterFillRect(const RasterTarget& target, Rect const rect, Color const color,
+                    BlendMode const mode) {
+    // Clip once, so the row loop below never has to bounds check
+    Rect const clipped = rect.Intersect(target.clip);
+    if (clipped.Empty() || IsNoOpBlend(color, mode)) {
+        return;
+    }
+
+    int const spanWidth = clipped.Width();
+    uint32_t* row = target.pixels + clipped.y0 * target.stride + clipped.x0;
+
+    if (!IsOpaqueBlend(color, mode)) {
+        for (int yPos = clipped.y0; yPos < clipped.y1; yPos++, row += target.stride) {
+            BlendSpan(row, color, spanWidth, mode);
+        }
+        return;
+    }
+
+    uint32_t const encodedColor = EncodeColor(color);
+
+    // Rectangles spanning whole rows are one contiguous span, fill them in a single pass
+    if (spanWidth == target.stride) {
+        FillSpan(row, encodedColor, spanWidth * clipped.Height());
+        return;
+    }
+
+    for (int yPos = clipped.y0; yPos < clipped.y1; yPos++, row += target.stride) {
+        FillSpan(row, encodedColor, spanWidth);
+    }
+}
+
+Rect LineBounds(int const p1x, int const p1y, int const dx, int const dy, int const w,
+                bool const antialias) {
+    if (w > 1 || antialias) {
+        Point const points[2] = {{p1x, p1y}, {p1x + dx, p1y + dy}};
+        return StrokeBounds(points, 2, {w, LineJoin::None, antialias});
+    }
+
+    int const p2x = p1x + dx;
+    int const p2y = p1y + dy;
+    return {std::min(p1x, p2x), std::min(p1y, p2y), std::max(p1x, p2x) + 1, std::max(p1y, p2y) + 1};
+}
+
+void RasterLine(const RasterTarget& target, int const p1x, int const p1y, int const dx,
+                int const dy, int const w, Color const color, BlendMode const mode,
+                bool const antialias) {
+    if (w > 1 || antialias) {
+        Point const points[2] = {{p1x, p1y}, {p1x + dx, p1y + dy}};
+        RasterStroke(target, points, 2, {w, LineJoin::None, antialias}, color, mode);
+        return;
+    }
+
+    if (LineBounds(p1x, p1y, dx, dy, w, false).Intersect(target.clip).Empty() ||
+        IsNoOpBlend(color, mode)) {
+        return;
+    }
+
+    int p2x = p1x + dx;
+    int p2y = p1y + dy;
+    int adx = abs(dx);
+    int ady = -abs(dy);
+
+    int sx = dx >= 0 ? 1 : -1;
+    int sy = dy >= 0 ? 1 : -1;
+
+    int err = adx + ady;
+
+    int x = p1x;
+    int y = p1y;
+
+    while (true) {
+        RasterPixel(target, x, y, color, mode);
+
+        if (x == p2x && y == p2y)
+            break;
+
+        int e2 = 2 * err;
+
+        if (e2 >= ady) {
+            err += ady;
+            x += sx;
+        }
+        if (e2 <= adx) {
+            err += adx;
+            y += sy;
+        }
+    }
+}
+
+void RasterGlyph(const RasterTarget& target, const uint8_t* coverage, int const w, int const h,
+                 int const pitch, int const x, int const y, Color const color,
+                 Color const background, BlendMode const mode) {
+    Rect const clipped = Rect::FromSize(x, y, w, h).Intersect(target.clip);
+    if (clipped.Empty() || (background.a == 0 && IsNoOpBlend(color, mode))) {
+        return;
+    }
+
+    int const spanWidth = clipped.Width();
+    for (int yPos = clipped.y0; yPos < clipped.y1; yPos++) {
+        const uint8_t* src = coverage + (yPos - y) * pitch + (clipped.x0 - x);
+        uint32_t* dst = target.pixels + yPos * target.stride + clipped.x0;
+        BlendMaskSpan(dst, src, spanWidth, color, background, mode);
+    }
+}
+
+void RasterBlit(const RasterTarget& target, const uint32_t* src, int const w, int const h,
+                int const srcStride, int const x, int const y, BlendMode const mode) {
+    Rect const clipped = Rect::FromSize(x, y, w, h).Intersect(target.clip);
+    if (clipped.Empty()) {
+        return;
+    }
+
+    int const spanWidth = clipped.Width();
+    const uint32_t* srcRow = src + (clipped.y0 - y) * srcStride + (clipped.x0 - x);
+    uint32_t* dstRow = target.pixels + clipped.y0 * target.stride + clipped.x0;
+    if (mode == BlendMode::Replace) {
+        CopyRows(dstRow, target.stride, srcRow, srcStride, spanWidth, clipped.Height());
+        return;
+    }
+    for (int yPos = clipped.y0; yPos < clipped.y1; yPos++) {
+        BlendRow(dstRow, srcRow, spanWidth, mode);
+        srcRow += srcStride;
+        dstRow += target.stride;
+    }
+}
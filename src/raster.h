@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "blend.h"
+#include "color.h"
+#include "rect.h"
+
+// Destination of the raster functions: a 32bpp surface and the part of it that may be written.
+// Scene2D rasterizes with the whole screen as the clip, the tiled renderer with one tile at a time.
+// Every function writes exactly the same pixels for a given draw no matter how the clip splits it.
+struct RasterTarget {
+    uint32_t* pixels;
+    int stride; // in pixels
+    Rect clip;
+};
+
+// Fills `count` pixels starting at `dst` with an already encoded color
+void FillSpan(uint32_t* dst, uint32_t value, int count);
+// Copies `height` rows of `width` pixels, strides in pixels. Source and destination don't overlap.
+void CopyRows(uint32_t* dst, int dstStride, const uint32_t* src, int srcStride, int width,
+              int height);
+
+// Draws `count` pixels of an antialiased shape that are `coverage` / 255 covered: color.a is scaled
+// by coverage, and partially covered pixels are blended even with Replace
+void FillCoverageSpan(uint32_t* dst, int count, uint8_t coverage, Color color, BlendMode mode);
+
+// Draws that are a plain overwrite (see IsOpaqueBlend) write EncodeColor(color) like they always
+// have, everything else goes through the blend kernels.
+void RasterPixel(const RasterTarget& target, int x, int y, Color color, BlendMode mode);
+void RasterFillRect(const RasterTarget& target, Rect rect, Color color, BlendMode mode);
+
+// Line from (p1x, p1y) to (p1x + dx, p1y + dy). One pixel wide aliased lines are plain Bresenham,
+// anything wider or antialiased is stroked with RasterStroke.
+void RasterLine(const RasterTarget& target, int p1x, int p1y, int dx, int dy, int w, Color color,
+                BlendMode mode, bool antialias);
+Rect LineBounds(int p1x, int p1y, int dx, int dy, int w, bool antialias);
+
+// Draws an 8-bit coverage bitmap with its top-left corner at (x, y), using coverage times color.a
+// as the alpha. Edges blend toward `background`, or with the frame buffer if its alpha is 0; see
+// BlendMaskSpan.
+void RasterGlyph(const RasterTarget& target, const uint8_t* coverage, int w, int h, int pitch,
+                 int x, int y, Color color, Color background, BlendMode mode);
+
+// Draws a w x h block of pixels with its top-left corner at (x, y). Replace copies the rows, the
+// other modes blend them using each source pixel's alpha.
+void RasterBlit(const RasterTarget& target, const uint32_t* src, int w, int h, int srcStride,
+                int x, int y, BlendMode mode);
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <algorithm>
+
+#include "types.h"
+
+struct Point {
+    int x;
+    int y;
+};
+
+// Axis-aligned pixel rectangle, [x0, x1) x [y0, y1).
+struct Rect {
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+
+    static constexpr Rect FromSize(int x, int y, int w, int h) {
+        return {x, y, x + w, y + h};
+    }
+
+    constexpr int Width() const {
+        return x1 - x0;
+    }
+    constexpr int Height() const {
+        return y1 - y0;
+    }
+    constexpr bool Empty() const {
+        return x0 >= x1 || y0 >= y1;
+    }
+    constexpr u64 Area() const {
+        return Empty() ? 0 : u64(Width()) * u64(Height());
+    }
+
+    constexpr bool Contains(const Rect& other) const {
+        return other.x0 >= x0 && other.y0 >= y0 && other.x1 <= x1 && other.y1 <= y1;
+    }
+
+    constexpr Rect Intersect(const Rect& other) const {
+        return {std::max(x0, other.x0), std::max(y0, other.y0), std::min(x1, other.x1),
+                std::min(y1, other.y1)};
+    }
+
+    constexpr Rect Translate(int dx, int dy) const {
+        return {x0 + dx, y0 + dy, x1 + dx, y1 + dy};
+    }
+
+    // Bounding box of both rectangles
+    constexpr Rect Union(const Rect& other) const {
+        return {std::min(x0, other.x0), std::min(y0, other.y0), std::max(x1, other.x1),
+                std::max(y1, other.y1)};
+    }
+};
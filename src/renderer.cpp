@@ -1,52 +1,148 @@
+#include <stdlib.h>
+
 #include "assert.h"
+#include "logging.h"
 #include "renderer.h"
 
-Renderer::Renderer() {
-    Init();
+static std::string SystemFontPath() {
+#ifdef HOST_BUILD
+    // There is no system sandbox on the host, the font has to be pointed to explicitly
+    const char* path = getenv("HOST_FONT_PATH");
+    return path ? path : "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+#else
+    return fmt::format("/{}/common/font/DFHEI5-SONY.ttf", sceKernelGetFsSandboxRandomWord());
+#endif
+}
+
+Renderer::Renderer(FontLoading fontLoading, int frameBuffers) {
+    Init(fontLoading, frameBuffers);
 }
 
 Renderer::~Renderer() {
-    FT_Done_Face(font);
+    WaitForFonts();
+    if (fonts) {
+        for (FT_Face const face : fonts->Faces()) {
+            scene->TextLayouts().Forget(face);
+        }
+        fonts.reset();
+    }
+    delete scene;
 }
 
-void Renderer::Init() {
+void Renderer::Init(FontLoading fontLoading, int frameBuffers) {
     if (!scene) {
         scene = new Scene2D(1920, 1080, 4);
-        ASSERT_MSG(scene->Init(0xC000000, 2), "Failed to initialize 2D scene");
+        ASSERT_MSG(scene->Init(0xC000000, frameBuffers), "Failed to initialize 2D scene");
     }
-    if (!scene->ftLib) {
-        ASSERT_OK(scene->InitFontLib());
-        std::string font_path =
-            fmt::format("/{}/common/font/DFHEI5-SONY.ttf", sceKernelGetFsSandboxRandomWord());
-        ASSERT_MSG(scene->InitFont(&font, font_path.c_str(), 80) && font != nullptr,
-                   "Failed to init font");
+    if (!fontThread.joinable() && !scene->ftLib) {
+        if (fontLoading == FontLoading::Immediate) {
+            ASSERT_MSG(loadFonts(), "Failed to init font");
+            fontsReady.store(true, std::memory_order_release);
+        } else {
+            // Nothing else touches FreeType or the fonts until fontsReady is set
+            fontThread = std::thread([this] {
+                if (loadFonts()) {
+                    fontsReady.store(true, std::memory_order_release);
+                } else {
+                    LOG_ERROR("Failed to init font");
+                }
+            });
+        }
     }
 }
 
+bool Renderer::WaitForFonts() {
+    if (fontThread.joinable()) {
+        fontThread.join();
+    }
+    return FontsReady();
+}
+
+bool Renderer::loadFonts() {
+    if (scene->InitFontLib() != ORBIS_OK) {
+        return false;
+    }
+    fonts = std::make_unique<FontManager>(scene->ftLib);
+    std::string font_path = SystemFontPath();
+    systemFont = fonts->Load(font_path.c_str());
+    font = fonts->Get(systemFont, 80);
+    return font != nullptr;
+}
+
 void Renderer::BeginFrame() {
+#ifdef _DEBUG
+    u64 const allocations = HeapAllocationCount();
+    this->frameHeapAllocations = allocations - this->frameStartAllocations;
+    this->frameStartAllocations = allocations;
+#endif
+    this->arena.Reset();
     scene->FrameBufferClear();
 }
 
 void Renderer::EndFrame() {
+    for (const DisplayList* list : submitted) {
+        scene->Execute(*list);
+    }
+    submitted.clear();
+
     scene->SubmitFlip();
     scene->FrameWait();
     scene->FrameBufferSwap();
 }
 
-void Renderer::DrawImage(const Image& img, int x, int y) {
-    auto* fb = (uint32_t*)scene->frameBuffers[scene->activeFrameBufferIdx];
-    ASSERT(fb != nullptr);
-    ASSERT(img.pixels != nullptr);
-
-    for (int j = 0; j < img.height; j++) {
-        for (int i = 0; i < img.width; i++) {
-            int sx = x + i;
-            int sy = y + j;
+void Renderer::DrawImage(ImageView img, int x, int y, BlendMode blend) {
+    // Empty when sliced from outside an image
+    if (img.Empty()) {
+        return;
+    }
+    scene->DrawBitmap(img.pixels, img.width, img.height, img.stride, x, y, blend);
+}
 
-            if (sx < 0 || sy < 0 || sx >= scene->width || sy >= scene->height)
-                continue;
+void Renderer::DrawImageScaled(ImageView img, int x, int y, int w, int h, ImageFilter filter,
+                               BlendMode blend) {
+    DrawImageRect(img, Rect::FromSize(0, 0, img.width, img.height), Rect::FromSize(x, y, w, h),
+                  filter, blend);
+}
 
-            fb[sy * scene->width + sx] = img.pixels[j * img.width + i];
+void Renderer::DrawImageRect(ImageView img, Rect src, Rect dst, ImageFilter filter,
+                             BlendMode blend) {
+    // Empty when sliced from outside an image, like DrawImage
+    Rect const bounds{0, 0, img.width, img.height};
+    Rect const clipped = src.Intersect(bounds);
+    if (img.Empty() || clipped.Empty() || dst.Empty()) {
+        return;
+    }
+    // Whatever part of `src` lies outside the image is cut from `dst` in proportion, so the rest
+    // is drawn where it would have been
+    if (!bounds.Contains(src)) {
+        auto const map = [](int value, int from0, int from1, int to0, int to1) {
+            return to0 + int(int64_t(value - from0) * (to1 - to0) / (from1 - from0));
+        };
+        dst = {map(clipped.x0, src.x0, src.x1, dst.x0, dst.x1),
+               map(clipped.y0, src.y0, src.y1, dst.y0, dst.y1),
+               map(clipped.x1, src.x0, src.x1, dst.x0, dst.x1),
+               map(clipped.y1, src.y0, src.y1, dst.y0, dst.y1)};
+        if (dst.Empty()) {
+            return;
         }
     }
+    scene->DrawBitmapScaled(img.pixels, img.stride, clipped, dst, filter, blend);
+}
+
+void Renderer::DrawTextSurface(const TextSurface& surface, int x, int y) {
+    Rect const bounds = surface.Bounds();
+    if (bounds.Empty()) {
+        return;
+    }
+    DrawImage(surface.View(), x + bounds.x0, y + bounds.y0, BlendMode::PremulSrcOver);
+}
+
+void Renderer::DrawText(TextSurface& surface, std::string_view txt, FT_Face face, int x, int y,
+                        Color color) {
+    surface.Update(txt, face, color);
+    DrawTextSurface(surface, x, y);
+}
+
+void Renderer::Submit(const DisplayList& list) {
+    submitted.push_back(&list);
 }
@@ -1,22 +1,100 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "display_list.h"
+#include "font_manager.h"
+#include "frame_arena.h"
 #include "graphics.h"
 #include "image.h"
+#include "text_surface.h"
+
+// How Renderer::Init opens the system font
+enum class FontLoading {
+    Immediate,  // before Init returns
+    Background, // on a thread of its own, so the first frames can be drawn while it loads
+};
 
 class Renderer {
 public:
-    Renderer();
+    static constexpr int DefaultFrameBuffers = 2;
+
+    // `frameBuffers` is the length of the display ring, see Scene2D::FrameWait: 2 for double
+    // buffering, 3 for triple buffering
+    explicit Renderer(FontLoading fontLoading = FontLoading::Immediate,
+                      int frameBuffers = DefaultFrameBuffers);
     ~Renderer();
 
-    void Init();
+    void Init(FontLoading fontLoading = FontLoading::Immediate,
+              int frameBuffers = DefaultFrameBuffers);
+
+    // Whether `fonts` and `font` can be used. Until then, text can be drawn with a baked font.
+    bool FontsReady() const {
+        return this->fontsReady.load(std::memory_order_acquire);
+    }
+    // Blocks until the background font load is over; returns FontsReady()
+    bool WaitForFonts();
 
     void BeginFrame();
     void EndFrame();
 
-    void DrawImage(const Image& img, int x, int y);
+    // With tiled rendering, `img` is read when the frame is flushed and must stay valid until then.
+    // Images convert to views; a part of one is drawn through img.Sub(...), without a copy.
+    void DrawImage(ImageView img, int x, int y, BlendMode blend = BlendMode::Replace);
+    // Draws the whole image stretched to w x h, its top-left corner at (x, y)
+    void DrawImageScaled(ImageView img, int x, int y, int w, int h,
+                         ImageFilter filter = ImageFilter::Bilinear,
+                         BlendMode blend = BlendMode::Replace);
+    // Draws the `src` part of the image stretched over `dst`. Parts of `src` outside the image
+    // are not drawn, and an empty image draws nothing.
+    void DrawImageRect(ImageView img, Rect src, Rect dst,
+                       ImageFilter filter = ImageFilter::Bilinear,
+                       BlendMode blend = BlendMode::Replace);
+    // Blends a surface onto the screen with its origin at (x, y). Text that stays the same from
+    // frame to frame is drawn by updating its surface and drawing that, once per frame.
+    void DrawTextSurface(const TextSurface& surface, int x, int y);
+    void DrawText(TextSurface& surface, std::string_view txt, FT_Face face, int x, int y,
+                  Color color);
+
+    // Queues a display list to be drawn at EndFrame, on top of anything drawn directly during the
+    // frame. Lists are drawn in submission order and must stay valid until EndFrame returns; the
+    // same list can be submitted again every frame.
+    void Submit(const DisplayList& list);
 
     Scene2D* GetScene() { return scene; }
 
+    // Memory that lives until the next BeginFrame, for strings and scratch buffers built while
+    // drawing a frame
+    FrameArena& Arena() {
+        return this->arena;
+    }
+#ifdef _DEBUG
+    // Heap allocations made by every thread between the last two BeginFrame calls, 0 once the
+    // frames reach a steady state
+    u64 FrameHeapAllocations() const {
+        return this->frameHeapAllocations;
+    }
+#endif
+
     Scene2D* scene{};
+    // Opens fonts at any size; `font` is the system font, file `systemFont`, at 80px. With
+    // FontLoading::Background, only touch these once FontsReady() is true.
+    std::unique_ptr<FontManager> fonts;
+    int systemFont{-1};
     FT_Face font{};
+
+private:
+    bool loadFonts();
+
+    std::vector<const DisplayList*> submitted;
+    FrameArena arena;
+#ifdef _DEBUG
+    u64 frameStartAllocations{};
+    u64 frameHeapAllocations{};
+#endif
+    std::thread fontThread;
+    std::atomic<bool> fontsReady{};
 };
\ No newline at end of file
@@ -0,0 +1,338 @@
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "blend.h"
+#include "glyph_cache.h"
+#include "sdf_text.h"
+
+// Felzenszwalb and Huttenlocher's squared distance transform of one row or column: d[q] is the
+// smallest (q - p)^2 + f[p]. `v` and `z` are scratch, n and n + 1 long.
+static void DistanceTransform(const float* f, float* d, int n, int* v, double* z) {
+    int k = 0;
+    v[0] = 0;
+    z[0] = -HUGE_VAL;
+    z[1] = HUGE_VAL;
+    auto const intersect = [&](int q, int p) {
+        return ((f[q] + double(q) * q) - (f[p] + double(p) * p)) / (2.0 * q - 2.0 * p);
+    };
+    for (int q = 1; q < n; q++) {
+        double s = intersect(q, v[k]);
+        while (s <= z[k]) {
+            k--;
+            s = intersect(q, v[k]);
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = HUGE_VAL;
+    }
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < q) {
+            k++;
+        }
+        d[q] = float(double(q - v[k]) * (q - v[k]) + f[v[k]]);
+    }
+}
+
+// Both passes of the 2D transform over a w x h grid, in place
+static void DistanceTransform(float* grid, int w, int h) {
+    int const n = std::max(w, h);
+    std::vector<float> f(n), d(n);
+    std::vector<int> v(n);
+    std::vector<double> z(n + 1);
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            f[y] = grid[size_t(y) * w + x];
+        }
+        DistanceTransform(f.data(), d.data(), h, v.data(), z.data());
+        for (int y = 0; y < h; y++) {
+            grid[size_t(y) * w + x] = d[y];
+        }
+    }
+    for (int y = 0; y < h; y++) {
+        float* row = grid + size_t(y) * w;
+        memcpy(f.data(), row, sizeof(float) * w);
+        DistanceTransform(f.data(), row, w, v.data(), z.data());
+    }
+}
+
+static int FloorDiv(int a, int b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static int CeilDiv(int a, int b) {
+    return -FloorDiv(-a, b);
+}
+
+size_t SdfGlyphCache::KeyHash::operator()(const Key& key) const {
+    u64 hash = reinterpret_cast<uintptr_t>(key.face);
+    hash = (hash ^ key.codepoint) * 0x9E3779B97F4A7C15ull;
+    return size_t(hash ^ (hash >> 32));
+}
+
+SdfGlyphCache& SdfGlyphCache::Shared() {
+    static SdfGlyphCache cache;
+    return cache;
+}
+
+const SdfGlyph& SdfGlyphCache::Find(FT_Face face, char32_t codepoint) {
+    std::lock_guard lock{this->mutex};
+    Key const key = {face, codepoint};
+    auto it = this->entries.find(key);
+    if (it == this->entries.end()) {
+        it = this->entries.emplace(key, generate(face, codepoint)).first;
+        this->bytes += size_t(it->second.glyph.width) * it->second.glyph.height;
+    }
+    return it->second.glyph;
+}
+
+SdfGlyphCache::Entry SdfGlyphCache::generate(FT_Face face, char32_t codepoint) {
+    Entry entry{};
+    if (!FT_IS_SCALABLE(face)) {
+        return entry;
+    }
+
+    // Glyphs the face doesn't have come from its fallbacks, like for bitmap text
+    FT_Face source = face;
+    FT_UInt const glyphIndex = GlyphCache::Shared().Resolve(source, codepoint);
+    if (!FT_IS_SCALABLE(source)) {
+        return entry;
+    }
+    // The outline is scaled relative to the face's pixel size, which is 0 until one is set
+    FT_Size_Metrics const& metrics = source->size->metrics;
+    if (metrics.x_ppem == 0 || metrics.y_ppem == 0) {
+        return entry;
+    }
+
+    // Load the unhinted outline scaled from the face's current size up to the oversampled base
+    // size, leaving the face's size alone for everything else that uses it
+    int constexpr HiSize = BaseSize * Oversample;
+    FT_Matrix matrix = {FT_Fixed(65536.0 * HiSize / metrics.x_ppem), 0, 0,
+                        FT_Fixed(65536.0 * HiSize / metrics.y_ppem)};
+    FT_Set_Transform(source, &matrix, nullptr);
+    FT_Error const error =
+        FT_Load_Glyph(source, glyphIndex, FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP);
+    FT_Set_Transform(source, nullptr, nullptr);
+    if (error != 0 || source->glyph->format != FT_GLYPH_FORMAT_OUTLINE ||
+        FT_Render_Glyph(source->glyph, FT_RENDER_MODE_NORMAL) != 0) {
+        return entry;
+    }
+
+    FT_GlyphSlot const slot = source->glyph;
+    FT_Bitmap const& bitmap = slot->bitmap;
+    SdfGlyph& glyph = entry.glyph;
+    glyph.advance = float(slot->linearHoriAdvance) / 65536.0f / metrics.x_ppem;
+    // Indices of a fallback's glyphs mean nothing to the face's kerning table
+    glyph.index = source == face ? glyphIndex : 0;
+    glyph.valid = true;
+    if (bitmap.width == 0 || bitmap.rows == 0) {
+        return entry;
+    }
+
+    // The field covers the bitmap plus Spread on every side, on the base pixel grid
+    int const bitmapW = int(bitmap.width);
+    int const bitmapH = int(bitmap.rows);
+    int const left = FloorDiv(slot->bitmap_left, Oversample) - Spread;
+    int const right = CeilDiv(slot->bitmap_left + bitmapW, Oversample) + Spread;
+    int const top = CeilDiv(slot->bitmap_top, Oversample) + Spread;
+    int const bottom = FloorDiv(slot->bitmap_top - bitmapH, Oversample) - Spread;
+    glyph.left = left;
+    glyph.top = top;
+    glyph.width = right - left;
+    glyph.height = top - bottom;
+
+    // Squared distances to the nearest texel inside (outer) and outside (inner) the glyph on the
+    // oversampled grid. Partly covered texels start at their estimated distance to the edge.
+    int const w = glyph.width * Oversample;
+    int const h = glyph.height * Oversample;
+    int const offsetX = slot->bitmap_left - left * Oversample;
+    int const offsetY = top * Oversample - slot->bitmap_top;
+    std::vector<float> outer(size_t(w) * h, 1e20f);
+    std::vector<float> inner(size_t(w) * h, 0.0f);
+    for (int y = 0; y < bitmapH; y++) {
+        const uint8_t* src = bitmap.buffer + y * bitmap.pitch;
+        size_t const row = size_t(y + offsetY) * w + offsetX;
+        for (int x = 0; x < bitmapW; x++) {
+            float const coverage = src[x] / 255.0f;
+            if (coverage == 0.0f) {
+                continue;
+            }
+            if (coverage == 1.0f) {
+                outer[row + x] = 0.0f;
+                inner[row + x] = 1e20f;
+                continue;
+            }
+            float const edge = 0.5f - coverage;
+            outer[row + x] = edge > 0.0f ? edge * edge : 0.0f;
+            inner[row + x] = edge < 0.0f ? edge * edge : 0.0f;
+        }
+    }
+    DistanceTransform(outer.data(), w, h);
+    DistanceTransform(inner.data(), w, h);
+
+    // Average each Oversample x Oversample block down to one texel, in base pixels
+    entry.field = std::make_unique<uint8_t[]>(size_t(glyph.width) * glyph.height);
+    float const toByte = 127.0f / (Spread * Oversample * Oversample * Oversample);
+    for (int y = 0; y < glyph.height; y++) {
+        for (int x = 0; x < glyph.width; x++) {
+            float sum = 0.0f;
+            for (int sy = 0; sy < Oversample; sy++) {
+                size_t const row = size_t(y * Oversample + sy) * w + x * Oversample;
+                for (int sx = 0; sx < Oversample; sx++) {
+                    sum += sqrtf(outer[row + sx]) - sqrtf(inner[row + sx]);
+                }
+            }
+            float const value = 128.0f - sum * toByte;
+            entry.field[size_t(y) * glyph.width + x] =
+                uint8_t(std::clamp(value + 0.5f, 0.0f, 255.0f));
+        }
+    }
+    glyph.field = entry.field.get();
+    return entry;
+}
+
+void SdfGlyphCache::Forget(FT_Face face) {
+    std::lock_guard lock{this->mutex};
+    for (auto it = this->entries.begin(); it != this->entries.end();) {
+        if (it->first.face == face) {
+            this->bytes -= size_t(it->second.glyph.width) * it->second.glyph.height;
+            it = this->entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void SdfGlyphCache::Clear() {
+    std::lock_guard lock{this->mutex};
+    this->entries.clear();
+    this->bytes = 0;
+}
+
+size_t SdfGlyphCache::SizeBytes() const {
+    std::lock_guard lock{this->mutex};
+    return this->bytes;
+}
+
+Rect SdfGlyphBounds(const SdfGlyph& glyph, float x, float y, float scale,
+                    const SdfTextStyle& style, bool shadow) {
+    // How far outside the glyph's edge anything is drawn, in destination pixels
+    float reach = 0.5f;
+    if (shadow) {
+        reach = style.outlineWidth + 0.5f * std::max(style.shadowSoftness, 1.0f);
+    } else if (style.outlineWidth > 0.0f || style.glowRadius > 0.0f) {
+        reach = style.outlineWidth + std::max(style.glowRadius, 0.5f);
+    }
+    // The outline sits Spread texels inside the field's borders, and bilinear filtering reaches
+    // one texel further
+    float const margin = std::min(reach / scale + 1.0f, float(SdfGlyphCache::Spread));
+    float const inset = SdfGlyphCache::Spread - margin;
+    return {int(floorf(x + (glyph.left + inset) * scale)),
+            int(floorf(y - (glyph.top - inset) * scale)),
+            int(ceilf(x + (glyph.left + glyph.width - inset) * scale)),
+            int(ceilf(y + (glyph.height - glyph.top - inset) * scale))};
+}
+
+static float Saturate(float value) {
+    return std::clamp(value, 0.0f, 1.0f);
+}
+
+// A straight color premultiplied by its alpha, in 0..255 with the alpha in 0..1
+struct PremulColor {
+    float r, g, b, a;
+
+    explicit PremulColor(Color color) {
+        this->a = color.a / 255.0f;
+        this->r = color.r * this->a;
+        this->g = color.g * this->a;
+        this->b = color.b * this->a;
+    }
+};
+
+void RasterSdfGlyph(const RasterTarget& target, const SdfGlyph& glyph, float x, float y,
+                    float scale, const SdfTextStyle& style, bool shadow) {
+    Rect const rect = SdfGlyphBounds(glyph, x, y, scale, style, shadow).Intersect(target.clip);
+    if (glyph.width == 0 || rect.Empty()) {
+        return;
+    }
+
+    // Texel coordinates of a pixel center are linear in the pixel's position
+    float const invScale = 1.0f / scale;
+    float const originX = (0.5f - x) * invScale - glyph.left - 0.5f;
+    float const originY = (0.5f - y) * invScale + glyph.top - 0.5f;
+    // Field bytes to signed destination pixels, positive outside
+    float const toPixels = float(SdfGlyphCache::Spread) / 127.0f * scale;
+    float const edge = style.outlineWidth;
+    bool const effects = !shadow && (style.outlineWidth > 0.0f || style.glowRadius > 0.0f);
+    float const shadowRamp = 1.0f / std::max(style.shadowSoftness, 1.0f);
+
+    // Layers of the effects, bottom up. One that is turned off is transparent, which keeps the
+    // per pixel loop free of branches.
+    PremulColor const fill(style.color);
+    PremulColor const outline(style.outlineWidth > 0.0f ? style.outlineColor : Color{0, 0, 0, 0});
+    PremulColor const glow(style.glowRadius > 0.0f ? style.glowColor : Color{0, 0, 0, 0});
+    float const glowRamp = 1.0f / std::max(style.glowRadius, 1e-3f);
+
+    int constexpr Chunk = 64;
+    float distance[Chunk];
+    uint8_t coverage[Chunk];
+    uint32_t colors[Chunk];
+    for (int py = rect.y0; py < rect.y1; py++) {
+        float const fy = std::clamp(originY + py * invScale, 0.0f, float(glyph.height - 1));
+        // Fields are at least 2 * Spread texels in each direction
+        int const y0 = std::min(int(fy), glyph.height - 2);
+        float const ty = fy - y0;
+        const uint8_t* row0 = glyph.field + size_t(y0) * glyph.width;
+        const uint8_t* row1 = row0 + glyph.width;
+        uint32_t* dst = target.pixels + size_t(py) * target.stride;
+
+        for (int start = rect.x0; start < rect.x1; start += Chunk) {
+            int const count = std::min(Chunk, rect.x1 - start);
+            for (int i = 0; i < count; i++) {
+                float const fx =
+                    std::clamp(originX + (start + i) * invScale, 0.0f, float(glyph.width - 1));
+                int const x0 = std::min(int(fx), glyph.width - 2);
+                float const tx = fx - x0;
+                float const top = row0[x0] + (row0[x0 + 1] - row0[x0]) * tx;
+                float const bottom = row1[x0] + (row1[x0 + 1] - row1[x0]) * tx;
+                distance[i] = (128.0f - (top + (bottom - top) * ty)) * toPixels;
+            }
+
+            if (effects) {
+                for (int i = 0; i < count; i++) {
+                    float const outside = distance[i] - edge;
+                    float const g = Saturate(1.0f - outside * glowRamp);
+                    float const o = Saturate(0.5f - outside);
+                    float const f = Saturate(0.5f - distance[i]);
+                    float const glowAlpha = g * g * glow.a;
+                    float const outlineAlpha = o * outline.a;
+                    float const fillAlpha = f * fill.a;
+                    // Each layer over the ones below it
+                    float const below = (1.0f - outlineAlpha) * (1.0f - fillAlpha);
+                    float const middle = 1.0f - fillAlpha;
+                    float const r = fill.r * f + outline.r * o * middle + glow.r * g * g * below;
+                    float const gr = fill.g * f + outline.g * o * middle + glow.g * g * g * below;
+                    float const b = fill.b * f + outline.b * o * middle + glow.b * g * g * below;
+                    float const a = fillAlpha + outlineAlpha * middle + glowAlpha * below;
+                    colors[i] = uint32_t(a * 255.0f + 0.5f) << 24 | uint32_t(r + 0.5f) << 16 |
+                                uint32_t(gr + 0.5f) << 8 | uint32_t(b + 0.5f);
+                }
+                BlendRow(dst + start, colors, count, BlendMode::PremulSrcOver);
+            } else {
+                float const offset = shadow ? edge : 0.0f;
+                float const ramp = shadow ? shadowRamp : 1.0f;
+                for (int i = 0; i < count; i++) {
+                    float const alpha = Saturate(0.5f - (distance[i] - offset) * ramp);
+                    coverage[i] = uint8_t(alpha * 255.0f + 0.5f);
+                }
+                Color const color = shadow ? style.shadowColor : style.color;
+                BlendMaskSpan(dst + start, coverage, count, color, {0, 0, 0, 0},
+                              BlendMode::SrcOver);
+            }
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <proto-include.h>
+
+#include "color.h"
+#include "raster.h"
+#include "rect.h"
+#include "types.h"
+#include "utf8.h"
+
+// A glyph as a signed distance field: each byte holds the distance from the texel's center to the
+// glyph's edge, 128 on the edge, growing inside and shrinking outside by 127 per Spread base
+// pixels. Sampled with bilinear filtering and thresholded, it draws the glyph at any size.
+struct SdfGlyph {
+    const uint8_t* field; // width x height bytes, packed
+    int width;
+    int height;
+    int left;      // from the pen position to the field's left edge, in base pixels
+    int top;       // from the baseline up to the field's top edge, in base pixels
+    float advance; // in ems, so at N pixels per em the pen moves advance * N
+    u32 index;     // in the face, for kerning
+    bool valid;    // false if the face has no outline for it, such glyphs are skipped
+};
+
+// How DrawSdfText draws. Distances are in destination pixels. Outline and glow extend outwards
+// from the glyph's edge and can't reach further than SdfGlyphCache::Spread base pixels, scaled to
+// the drawn size.
+struct SdfTextStyle {
+    Color color = {255, 255, 255};
+    float outlineWidth = 0.0f;
+    Color outlineColor = {0, 0, 0};
+    float glowRadius = 0.0f; // beyond the outline, fading out quadratically
+    Color glowColor = {255, 255, 255, 0};
+    int shadowX = 0;
+    int shadowY = 0;
+    float shadowSoftness = 1.0f; // width of the shadow's edge ramp
+    Color shadowColor = {0, 0, 0, 0};
+};
+
+// SdfGlyphCache turns glyph outlines into distance fields once, at BaseSize pixels per em, and
+// keeps them for as long as the face is around: unlike GlyphCache, a single entry serves every
+// size the glyph is drawn at. Fields are never evicted, only dropped by Forget and Clear, so a
+// glyph returned by Find stays valid until then. Only scalable faces with a pixel size set are
+// supported.
+class SdfGlyphCache {
+public:
+    static constexpr int BaseSize = 48;
+    static constexpr int Spread = 8;
+    // Outlines are rendered this many times larger and the field averaged down, which keeps
+    // corners sharp
+    static constexpr int Oversample = 4;
+
+    // The cache DrawSdfText goes through
+    static SdfGlyphCache& Shared();
+
+    SdfGlyphCache() = default;
+    SdfGlyphCache(const SdfGlyphCache&) = delete;
+    SdfGlyphCache& operator=(const SdfGlyphCache&) = delete;
+
+    // Looks up the field for `codepoint`, generating it on a miss. Uses the face's glyph slot,
+    // like any other FreeType load.
+    const SdfGlyph& Find(FT_Face face, char32_t codepoint);
+
+    // Drops everything cached for `face`. Must be called before the face is freed.
+    void Forget(FT_Face face);
+    void Clear();
+
+    size_t SizeBytes() const;
+
+private:
+    struct Key {
+        FT_Face face;
+        char32_t codepoint;
+
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    struct Entry {
+        SdfGlyph glyph;
+        std::unique_ptr<uint8_t[]> field;
+    };
+
+    static Entry generate(FT_Face face, char32_t codepoint);
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    size_t bytes{};
+};
+
+// Draws `glyph` with its pen position at (x, y), `scale` destination pixels per base pixel. With
+// `shadow`, only the shadow is drawn, at (x, y) as given; callers offset it by the style's shadow
+// offset and draw the shadows of a whole string before its glyphs.
+void RasterSdfGlyph(const RasterTarget& target, const SdfGlyph& glyph, float x, float y,
+                    float scale, const SdfTextStyle& style, bool shadow);
+// The pixels RasterSdfGlyph may touch: the glyph plus as far as the style's effects reach
+Rect SdfGlyphBounds(const SdfGlyph& glyph, float x, float y, float scale,
+                    const SdfTextStyle& style, bool shadow);
+
+// Walks UTF-8 text at `pixelSize` pixels per em, calling fn(const SdfGlyph& glyph, float x,
+// float y, float scale) with each glyph's pen position. Lines advance by the face's line height
+// at that size and pairs are kerned if the face has a kerning table.
+template <typename Fn>
+void RenderSdfGlyphs(std::string_view txt, FT_Face face, float pixelSize, float startX,
+                     float startY, Fn&& fn) {
+    if (!FT_IS_SCALABLE(face)) {
+        return;
+    }
+
+    SdfGlyphCache& cache = SdfGlyphCache::Shared();
+    float const scale = pixelSize / SdfGlyphCache::BaseSize;
+    float const emScale = pixelSize / face->units_per_EM;
+    bool const kerning = FT_HAS_KERNING(face);
+    float penX = 0.0f;
+    float penY = 0.0f;
+    u32 previous = 0;
+    for (size_t pos = 0; pos < txt.size();) {
+        char32_t const codepoint = DecodeUtf8(txt, pos);
+        if (codepoint == U'\n') {
+            penX = 0.0f;
+            penY += face->height * emScale;
+            previous = 0;
+            continue;
+        }
+
+        const SdfGlyph& glyph = cache.Find(face, codepoint);
+        if (!glyph.valid)
+            continue;
+
+        if (kerning && previous != 0 && glyph.index != 0) {
+            FT_Vector delta{};
+            FT_Get_Kerning(face, previous, glyph.index, FT_KERNING_UNSCALED, &delta);
+            penX += delta.x * emScale;
+        }
+        previous = glyph.index;
+        fn(glyph, startX + penX, startY + penY, scale);
+        penX += glyph.advance * pixelSize;
+    }
+}
@@ -0,0 +1,342 @@
+#include <math.h>
+
+#include <algorithm>
+
+#include "shapes.h"
+
+namespace {
+
+// Inclusive range of pixel columns
+struct PixelRange {
+    int x0;
+    int x1;
+
+    bool Empty() const {
+        return x0 > x1;
+    }
+    PixelRange Intersect(PixelRange other) const {
+        return {std::max(x0, other.x0), std::min(x1, other.x1)};
+    }
+};
+
+constexpr PixelRange kNoPixels = {0, -1};
+
+// Ellipse around (cx, cy), a circle when rx == ry. Coordinates are in pixels with pixel centers at
+// +0.5.
+struct EllipseShape {
+    float cx, cy, rx, ry;
+
+    // The row at py of the ellipse with both radii grown by `grow`. For a circle that is exactly
+    // the set of points within distance r + grow, for other ellipses it is close to it.
+    bool Interval(float py, float grow, float& lo, float& hi) const {
+        float const a = rx + grow;
+        float const b = ry + grow;
+        float const dy = py - cy;
+        if (a < 0 || b < 0 || fabsf(dy) > b) {
+            return false;
+        }
+        float const half = b > 0 ? a * sqrtf(std::max(0.0f, 1 - (dy / b) * (dy / b))) : a;
+        lo = cx - half;
+        hi = cx + half;
+        return true;
+    }
+
+    // Signed distance, negative inside. Exact for circles, a first order approximation otherwise.
+    float Distance(float px, float py) const {
+        float const x = px - cx;
+        float const y = py - cy;
+        if (rx == ry) {
+            return sqrtf(x * x + y * y) - rx;
+        }
+        float const k0 = sqrtf((x / rx) * (x / rx) + (y / ry) * (y / ry));
+        float const gx = x / (rx * rx);
+        float const gy = y / (ry * ry);
+        float const k1 = sqrtf(gx * gx + gy * gy);
+        return k1 > 0 ? k0 * (k0 - 1) / k1 : -std::min(rx, ry);
+    }
+};
+
+// [x0, x1] x [y0, y1] with corners rounded to r <= half the shorter side, in pixel edge
+// coordinates. Grown and shrunk rounded rectangles are rounded rectangles, so Interval is exact.
+struct RoundedRectShape {
+    float x0, y0, x1, y1, r;
+
+    bool Interval(float py, float grow, float& lo, float& hi) const {
+        float const ex0 = x0 - grow;
+        float const ey0 = y0 - grow;
+        float const ex1 = x1 + grow;
+        float const ey1 = y1 + grow;
+        float const er = std::max(r + grow, 0.0f);
+        if (py < ey0 || py > ey1 || ex0 > ex1) {
+            return false;
+        }
+        // How far into the rows of the top or bottom corners py is
+        float const dy = std::max(ey0 + er - py, py - (ey1 - er));
+        float const inset = dy > 0 ? er - sqrtf(std::max(0.0f, er * er - dy * dy)) : 0;
+        lo = ex0 + inset;
+        hi = ex1 - inset;
+        return lo <= hi;
+    }
+
+    float Distance(float px, float py) const {
+        float const qx = fabsf(px - (x0 + x1) * 0.5f) - ((x1 - x0) * 0.5f - r);
+        float const qy = fabsf(py - (y0 + y1) * 0.5f) - ((y1 - y0) * 0.5f - r);
+        float const ox = std::max(qx, 0.0f);
+        float const oy = std::max(qy, 0.0f);
+        return sqrtf(ox * ox + oy * oy) + std::min(std::max(qx, qy), 0.0f) - r;
+    }
+};
+
+// The wedge swept clockwise from direction (ux0, uy0) to (ux1, uy1) around (cx, cy)
+struct Sector {
+    float cx, cy;
+    float ux0, uy0, ux1, uy1;
+    bool wide; // sweeps more than half a turn
+
+    // Signed distance to the nearer boundary ray's line, negative inside
+    float Distance(float px, float py) const {
+        float const x = px - cx;
+        float const y = py - cy;
+        float const start = ux0 * y - uy0 * x;
+        float const end = x * uy1 - y * ux1;
+        return wide ? std::min(-start, -end) : std::max(-start, -end);
+    }
+};
+
+// floorf and ceilf are library calls without SSE4.1, and every row needs several of them
+int FloorToInt(float value) {
+    int const truncated = int(value);
+    return truncated - (value < float(truncated));
+}
+
+int CeilToInt(float value) {
+    int const truncated = int(value);
+    return truncated + (value > float(truncated));
+}
+
+// Pixel columns whose centers lie within [lo, hi]
+PixelRange CenterRange(float lo, float hi) {
+    return {CeilToInt(lo - 0.5f), FloorToInt(hi - 0.5f)};
+}
+
+// Pixel columns whose centers lie strictly within (lo, hi)
+PixelRange OpenCenterRange(float lo, float hi) {
+    return {FloorToInt(lo - 0.5f) + 1, CeilToInt(hi - 0.5f) - 1};
+}
+
+uint8_t CoverageFromDistance(float distance) {
+    return uint8_t(std::clamp(0.5f - distance, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+} // namespace
+
+// Draws the pixels of `shape` within `bounds`, or of its outline band when thickness > 0. Per row,
+// everything between the fully covered spans is shaded by coverage(px, py); `perPixel` sends the
+// whole row through it, for shapes Interval only bounds (arcs). `slop` is how far Interval may be
+// off from the true distance.
+template <typename Shape, typename Coverage>
+static void RasterRows(const RasterTarget& target, Rect bounds, Shape const& shape,
+                       float thickness, float slop, bool perPixel, Coverage&& coverage,
+                       Color color, BlendMode mode, bool antialias) {
+    Rect const clipped = bounds.Intersect(target.clip);
+    if (clipped.Empty() || IsNoOpBlend(color, mode)) {
+        return;
+    }
+
+    // With antialiasing, pixels within half a pixel of the edge are partially covered
+    float const edge = antialias ? 0.5f + slop : 0.0f;
+    PixelRange const clipRange = {clipped.x0, clipped.x1 - 1};
+
+    auto const range = [&](float py, float grow, bool open) {
+        float lo, hi;
+        if (!shape.Interval(py, grow, lo, hi)) {
+            return kNoPixels;
+        }
+        return open ? OpenCenterRange(lo, hi) : CenterRange(lo, hi);
+    };
+
+    for (int y = clipped.y0; y < clipped.y1; y++) {
+        float const py = y + 0.5f;
+        uint32_t* dst = target.pixels + y * target.stride;
+
+        PixelRange const outer = range(py, edge, false).Intersect(clipRange);
+        if (outer.Empty()) {
+            continue;
+        }
+        // Pixels that need no coverage, and the outline's hole with the band along its edge
+        PixelRange full = antialias ? range(py, -edge, false) : outer;
+        PixelRange hole = kNoPixels;
+        PixelRange holeEdge = kNoPixels;
+        if (thickness > 0) {
+            hole = range(py, -thickness - edge, !antialias);
+            holeEdge = antialias ? range(py, -thickness + edge, false) : hole;
+        }
+        if (perPixel) {
+            full = kNoPixels;
+        }
+
+        // Runs of equal coverage, mostly the fully covered inside of an arc, go out as one span
+        auto const shadeEdge = [&](int x0, int x1) {
+            int runStart = x0;
+            uint8_t runValue = 0;
+            for (int x = x0; x <= x1; x++) {
+                uint8_t const value = coverage(x + 0.5f, py);
+                if (value != runValue) {
+                    if (runValue != 0) {
+                        FillCoverageSpan(dst + runStart, x - runStart, runValue, color, mode);
+                    }
+                    runStart = x;
+                    runValue = value;
+                }
+            }
+            if (runValue != 0) {
+                FillCoverageSpan(dst + runStart, x1 + 1 - runStart, runValue, color, mode);
+            }
+        };
+
+        // Left and right of the hole, or the whole row
+        PixelRange segments[2] = {outer, kNoPixels};
+        if (!hole.Empty()) {
+            segments[0] = outer.Intersect({outer.x0, hole.x0 - 1});
+            segments[1] = outer.Intersect({hole.x1 + 1, outer.x1});
+        }
+        for (PixelRange const segment : segments) {
+            if (segment.Empty()) {
+                continue;
+            }
+            PixelRange fills[2] = {segment.Intersect(full), kNoPixels};
+            if (!holeEdge.Empty()) {
+                fills[0] = segment.Intersect(full).Intersect({full.x0, holeEdge.x0 - 1});
+                fills[1] = segment.Intersect(full).Intersect({holeEdge.x1 + 1, full.x1});
+            }
+
+            int x = segment.x0;
+            for (PixelRange const fill : fills) {
+                if (fill.Empty()) {
+                    continue;
+                }
+                shadeEdge(x, fill.x0 - 1);
+                FillCoverageSpan(dst + fill.x0, fill.x1 - fill.x0 + 1, 255, color, mode);
+                x = fill.x1 + 1;
+            }
+            shadeEdge(x, segment.x1);
+        }
+    }
+}
+
+// Coverage of an antialiased shape or its outline band from the shape's distance function
+template <typename Shape>
+static auto ShapeCoverage(Shape const& shape, float thickness) {
+    return [&shape, thickness](float px, float py) {
+        float distance = shape.Distance(px, py);
+        if (thickness > 0) {
+            distance = fabsf(distance + thickness * 0.5f) - thickness * 0.5f;
+        }
+        return CoverageFromDistance(distance);
+    };
+}
+
+void RasterEllipse(const RasterTarget& target, int cx, int cy, int rx, int ry, int thickness,
+                   Color color, BlendMode mode, bool antialias) {
+    if (rx < 0 || ry < 0) {
+        return;
+    }
+    EllipseShape const shape = {cx + 0.5f, cy + 0.5f, float(rx), float(ry)};
+    float const t = float(std::max(thickness, 0));
+    // The distance approximation of a non-circular ellipse may be off by a fraction of a pixel,
+    // widen the band that gets per pixel coverage to match
+    float const slop = rx == ry ? 0.0f : 0.5f;
+    RasterRows(target, EllipseBounds(cx, cy, rx, ry), shape, t, slop, false,
+               ShapeCoverage(shape, t), color, mode, antialias);
+}
+
+Rect EllipseBounds(int cx, int cy, int rx, int ry) {
+    // One extra pixel for antialiasing
+    return {cx - rx - 1, cy - ry - 1, cx + rx + 2, cy + ry + 2};
+}
+
+void RasterArc(const RasterTarget& target, int cx, int cy, int radius, int thickness,
+               float startDegrees, float sweepDegrees, Color color, BlendMode mode,
+               bool antialias) {
+    if (radius < 0 || sweepDegrees == 0) {
+        return;
+    }
+    if (fabsf(sweepDegrees) >= 360) {
+        RasterEllipse(target, cx, cy, radius, radius, thickness, color, mode, antialias);
+        return;
+    }
+    if (sweepDegrees < 0) {
+        startDegrees += sweepDegrees;
+        sweepDegrees = -sweepDegrees;
+    }
+
+    EllipseShape const ring = {cx + 0.5f, cy + 0.5f, float(radius), float(radius)};
+    float const t = float(std::max(thickness, 0));
+    float const start = startDegrees * float(M_PI / 180);
+    float const end = (startDegrees + sweepDegrees) * float(M_PI / 180);
+    Sector const sector = {ring.cx,   ring.cy,   cosf(start), sinf(start),
+                           cosf(end), sinf(end), sweepDegrees > 180};
+
+    auto const ringCoverage = ShapeCoverage(ring, t);
+    auto const coverage = [&](float px, float py) {
+        if (!antialias) {
+            // The ring itself is already exact
+            return uint8_t(sector.Distance(px, py) <= 0 ? 255 : 0);
+        }
+        return std::min(ringCoverage(px, py), CoverageFromDistance(sector.Distance(px, py)));
+    };
+    RasterRows(target, ArcBounds(cx, cy, radius, thickness, startDegrees, sweepDegrees), ring, t,
+               0.0f, true, coverage, color, mode, antialias);
+}
+
+Rect ArcBounds(int cx, int cy, int radius, int thickness, float startDegrees, float sweepDegrees) {
+    if (fabsf(sweepDegrees) >= 360) {
+        return EllipseBounds(cx, cy, radius, radius);
+    }
+    if (sweepDegrees < 0) {
+        startDegrees += sweepDegrees;
+        sweepDegrees = -sweepDegrees;
+    }
+
+    // The ends of the arc on both edges of the band, and wherever the outer edge crosses an axis
+    float const inner = thickness > 0 ? std::max(radius - thickness, 0) : 0;
+    float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+    auto const include = [&](float degrees, float r) {
+        float const angle = degrees * float(M_PI / 180);
+        float const x = r * cosf(angle);
+        float const y = r * sinf(angle);
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    };
+    for (float const degrees : {startDegrees, startDegrees + sweepDegrees}) {
+        include(degrees, float(radius));
+        include(degrees, inner);
+    }
+    for (float axis = ceilf(startDegrees / 90) * 90; axis <= startDegrees + sweepDegrees;
+         axis += 90) {
+        include(axis, float(radius));
+    }
+
+    // Pixel centers sit half a pixel off the integer grid, and antialiasing reaches one further
+    return {cx + int(floorf(minX)) - 1, cy + int(floorf(minY)) - 1, cx + int(ceilf(maxX)) + 2,
+            cy + int(ceilf(maxY)) + 2};
+}
+
+void RasterRoundedRect(const RasterTarget& target, Rect rect, int radius, int thickness,
+                       Color color, BlendMode mode, bool antialias) {
+    if (rect.Empty()) {
+        return;
+    }
+    float const r = float(std::clamp(radius, 0, std::min(rect.Width(), rect.Height()) / 2));
+    RoundedRectShape const shape = {float(rect.x0), float(rect.y0), float(rect.x1),
+                                    float(rect.y1), r};
+    float const t = float(std::max(thickness, 0));
+    RasterRows(target, RoundedRectBounds(rect), shape, t, 0.0f, false, ShapeCoverage(shape, t),
+               color, mode, antialias);
+}
+
+Rect RoundedRectBounds(Rect rect) {
+    return {rect.x0 - 1, rect.y0 - 1, rect.x1 + 1, rect.y1 + 1};
+}
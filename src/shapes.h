@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "blend.h"
+#include "color.h"
+#include "raster.h"
+#include "rect.h"
+
+// Curved primitives, filled one scanline span at a time like RasterFillRect. Each row's spans are
+// solved in closed form, so a shape costs about as much as a rectangle of the same area and rows
+// come out the same no matter how the clip splits them.
+//
+// `thickness` 0 fills the shape, anything else outlines it with a band that many pixels wide on
+// the inside of its edge. With antialiasing, only the pixels along the edges are shaded by coverage
+// (see FillCoverageSpan); aliased shapes cover the pixels whose centers lie inside.
+
+// Ellipse centered on the center of pixel (cx, cy). rx == ry draws a circle.
+void RasterEllipse(const RasterTarget& target, int cx, int cy, int rx, int ry, int thickness,
+                   Color color, BlendMode mode, bool antialias);
+Rect EllipseBounds(int cx, int cy, int rx, int ry);
+
+// The part of a circle outline from `startDegrees` through `sweepDegrees`, with straight ends.
+// 0 degrees points right and angles grow clockwise on screen, so -90 is the top of the circle.
+void RasterArc(const RasterTarget& target, int cx, int cy, int radius, int thickness,
+               float startDegrees, float sweepDegrees, Color color, BlendMode mode,
+               bool antialias);
+Rect ArcBounds(int cx, int cy, int radius, int thickness, float startDegrees, float sweepDegrees);
+
+// Rectangle with its corners rounded to `radius`, which is limited to half the shorter side.
+// Radius 0 fills exactly the pixels RasterFillRect does.
+void RasterRoundedRect(const RasterTarget& target, Rect rect, int radius, int thickness,
+                       Color color, BlendMode mode, bool antialias);
+Rect RoundedRectBounds(Rect rect);
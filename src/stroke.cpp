@@ -0,0 +1,416 @@
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "stroke.h"
+
+namespace {
+
+struct Vec2 {
+    float x;
+    float y;
+};
+
+// One convex piece of a stroke: the intersection of up to four half-planes
+// nx * x + ny * y <= d with unit normals, or a disc when `edges` is 0. Coordinates are in pixels
+// with pixel centers at +0.5; the bounds already include the antialiasing margin.
+//
+// Edges are ordered by the side of a scanline they bound: first the right ends (nx > 0), then the
+// left ends (nx < 0), then horizontal edges, so Span runs without data-dependent branches.
+struct Shape {
+    float nx[4];
+    float ny[4];
+    float d[4];
+    float invNx[4]; // 1 / nx, 0 for horizontal edges
+    int edges;
+    int rightEdges;
+    int leftEdges;
+    float cx, cy, r;
+    float minX, minY, maxX, maxY;
+
+    // Signed distance from (px, py), negative inside. Exact for discs and inside polygons, a close
+    // enough underestimate outside polygon corners.
+    float Distance(float px, float py) const {
+        if (edges == 0) {
+            return hypotf(px - cx, py - cy) - r;
+        }
+        float dist = nx[0] * px + ny[0] * py - d[0];
+        for (int i = 1; i < edges; i++) {
+            dist = std::max(dist, nx[i] * px + ny[i] * py - d[i]);
+        }
+        return dist;
+    }
+
+    // The x range where Distance(x, py) <= margin, if any
+    bool Span(float py, float margin, float& lo, float& hi) const {
+        if (edges == 0) {
+            float const dy = py - cy;
+            float const rr = r + margin;
+            if (rr < 0 || dy * dy > rr * rr) {
+                return false;
+            }
+            float const half = sqrtf(rr * rr - dy * dy);
+            lo = cx - half;
+            hi = cx + half;
+            return true;
+        }
+
+        lo = -INFINITY;
+        hi = INFINITY;
+        int i = 0;
+        for (; i < rightEdges; i++) {
+            hi = std::min(hi, (d[i] + margin - ny[i] * py) * invNx[i]);
+        }
+        for (; i < rightEdges + leftEdges; i++) {
+            lo = std::max(lo, (d[i] + margin - ny[i] * py) * invNx[i]);
+        }
+        for (; i < edges; i++) {
+            if (d[i] + margin - ny[i] * py < 0) {
+                return false;
+            }
+        }
+        return lo <= hi;
+    }
+
+    // The pixels within the clip whose centers are within `margin` of the shape on row y
+    bool PixelSpan(int y, float margin, Rect const& clip, int& x0, int& x1) const {
+        float lo, hi;
+        if (!Span(y + 0.5f, margin, lo, hi)) {
+            return false;
+        }
+        lo = std::max(lo, float(clip.x0) - 1);
+        hi = std::min(hi, float(clip.x1) + 1);
+        x0 = std::max(clip.x0, int(ceilf(lo - 0.5f)));
+        x1 = std::min(clip.x1 - 1, int(floorf(hi - 0.5f)));
+        return x0 <= x1;
+    }
+};
+
+struct PixelRange {
+    int x0;
+    int x1; // inclusive
+};
+
+// Reused between calls, tiles are rasterized on several threads at once
+struct StrokeScratch {
+    std::vector<Vec2> centers;
+    std::vector<Shape> shapes;
+    std::vector<const Shape*> order;
+    std::vector<const Shape*> active;
+    std::vector<PixelRange> ranges;
+    std::vector<uint8_t> coverage;
+};
+thread_local StrokeScratch scratch;
+
+} // namespace
+
+static void AddPolygon(std::vector<Shape>& shapes, const Vec2* v, int count, float margin) {
+    Vec2 center = {0, 0};
+    for (int i = 0; i < count; i++) {
+        center.x += v[i].x / count;
+        center.y += v[i].y / count;
+    }
+
+    Shape shape{};
+    shape.minX = shape.maxX = v[0].x;
+    shape.minY = shape.maxY = v[0].y;
+    Vec2 normals[4];
+    float dists[4];
+    int numEdges = 0;
+    for (int i = 0; i < count; i++) {
+        Vec2 const a = v[i];
+        Vec2 const b = v[(i + 1) % count];
+        shape.minX = std::min(shape.minX, a.x);
+        shape.maxX = std::max(shape.maxX, a.x);
+        shape.minY = std::min(shape.minY, a.y);
+        shape.maxY = std::max(shape.maxY, a.y);
+
+        float const len = sqrtf((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
+        if (len < 1e-4f) {
+            continue;
+        }
+        // Whichever way the vertices wind, make the normal point away from the center
+        float nx = (b.y - a.y) / len;
+        float ny = (a.x - b.x) / len;
+        float d = nx * a.x + ny * a.y;
+        if (nx * center.x + ny * center.y > d) {
+            nx = -nx;
+            ny = -ny;
+            d = -d;
+        }
+        normals[numEdges] = {nx, ny};
+        dists[numEdges] = d;
+        numEdges++;
+    }
+
+    // Degenerate, e.g. a bevel between two collinear segments
+    if (numEdges < 3) {
+        return;
+    }
+
+    auto const addEdges = [&](auto&& predicate) {
+        int added = 0;
+        for (int i = 0; i < numEdges; i++) {
+            if (predicate(normals[i].x)) {
+                shape.nx[shape.edges] = normals[i].x;
+                shape.ny[shape.edges] = normals[i].y;
+                shape.d[shape.edges] = dists[i];
+                shape.invNx[shape.edges] = fabsf(normals[i].x) > 1e-6f ? 1 / normals[i].x : 0;
+                shape.edges++;
+                added++;
+            }
+        }
+        return added;
+    };
+    shape.rightEdges = addEdges([](float nx) { return nx > 1e-6f; });
+    shape.leftEdges = addEdges([](float nx) { return nx < -1e-6f; });
+    addEdges([](float nx) { return fabsf(nx) <= 1e-6f; });
+    shape.minX -= margin;
+    shape.minY -= margin;
+    shape.maxX += margin;
+    shape.maxY += margin;
+    shapes.push_back(shape);
+}
+
+static void AddDisc(std::vector<Shape>& shapes, Vec2 center, float r, float margin) {
+    Shape shape{};
+    shape.cx = center.x;
+    shape.cy = center.y;
+    shape.r = r;
+    shape.minX = center.x - r - margin;
+    shape.maxX = center.x + r + margin;
+    shape.minY = center.y - r - margin;
+    shape.maxY = center.y + r + margin;
+    shapes.push_back(shape);
+}
+
+static Vec2 Direction(Vec2 from, Vec2 to) {
+    float const len = sqrtf((to.x - from.x) * (to.x - from.x) + (to.y - from.y) * (to.y - from.y));
+    return len > 0 ? Vec2{(to.x - from.x) / len, (to.y - from.y) / len} : Vec2{1, 0};
+}
+
+// Adds the pieces of the stroke that may reach `clip`
+static void BuildShapes(std::vector<Shape>& shapes, const Point* points, int count,
+                        StrokeStyle const& style, float margin, Rect const& clip) {
+    float const half = std::max(style.width, 1) * 0.5f;
+    // How far any piece of a segment, its caps or its joins reaches beyond the segment's points
+    float const reach = half * 1.4143f + margin + 1;
+
+    // Pixel centers, without repeated points, which have no direction
+    std::vector<Vec2>& centers = scratch.centers;
+    centers.clear();
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && points[i].x == points[i - 1].x && points[i].y == points[i - 1].y) {
+            continue;
+        }
+        centers.push_back({points[i].x + 0.5f, points[i].y + 0.5f});
+    }
+    if (centers.size() == 1) {
+        // A single point still gets its square caps
+        centers.push_back(centers[0]);
+    }
+
+    int const segments = int(centers.size()) - 1;
+    for (int i = 0; i < segments; i++) {
+        Vec2 const p0 = centers[i];
+        Vec2 const p1 = centers[i + 1];
+        // A tile usually sees a small part of a long polyline
+        if (std::min(p0.x, p1.x) - reach > clip.x1 || std::max(p0.x, p1.x) + reach < clip.x0 ||
+            std::min(p0.y, p1.y) - reach > clip.y1 || std::max(p0.y, p1.y) + reach < clip.y0) {
+            continue;
+        }
+
+        Vec2 const dir = Direction(p0, p1);
+        Vec2 const n = {-dir.y * half, dir.x * half};
+
+        if (i > 0 && style.join != LineJoin::None) {
+            if (style.join == LineJoin::Round) {
+                AddDisc(shapes, p0, half, margin);
+            } else {
+                // Fill the notch on the outside of the turn
+                Vec2 const prevDir = Direction(centers[i - 1], p0);
+                float const cross = prevDir.x * dir.y - prevDir.y * dir.x;
+                float const side = cross > 0 ? -1.0f : 1.0f;
+                Vec2 const prevN = {-prevDir.y * half, prevDir.x * half};
+                Vec2 const bevel[3] = {p0,
+                                       {p0.x + prevN.x * side, p0.y + prevN.y * side},
+                                       {p0.x + n.x * side, p0.y + n.y * side}};
+                AddPolygon(shapes, bevel, 3, margin);
+            }
+        }
+
+        // Square caps at both ends of the polyline, butt ends at the joins
+        float const startCap = i == 0 ? half : 0;
+        float const endCap = i == segments - 1 ? half : 0;
+        Vec2 const a = {p0.x - dir.x * startCap, p0.y - dir.y * startCap};
+        Vec2 const b = {p1.x + dir.x * endCap, p1.y + dir.y * endCap};
+        Vec2 const quad[4] = {{a.x + n.x, a.y + n.y},
+                              {b.x + n.x, b.y + n.y},
+                              {b.x - n.x, b.y - n.y},
+                              {a.x - n.x, a.y - n.y}};
+        AddPolygon(shapes, quad, 4, margin);
+    }
+}
+
+void RasterStroke(const RasterTarget& target, const Point* points, int count,
+                  StrokeStyle const& style, Color color, BlendMode mode) {
+    const Rect& clip = target.clip;
+    if (count <= 0 || clip.Empty() || IsNoOpBlend(color, mode) ||
+        StrokeBounds(points, count, style).Intersect(clip).Empty()) {
+        return;
+    }
+
+    // With antialiasing a pixel is touched while its center is within half a pixel of the stroke
+    float const margin = style.antialias ? 0.5f : 0.0f;
+
+    std::vector<Shape>& shapes = scratch.shapes;
+    shapes.clear();
+    BuildShapes(shapes, points, count, style, margin, clip);
+
+    // Only the pieces overlapping the clip matter, in the order the scanlines reach them
+    std::vector<const Shape*>& order = scratch.order;
+    order.clear();
+    float maxY = -INFINITY;
+    for (Shape const& shape : shapes) {
+        if (shape.maxX >= clip.x0 && shape.minX <= clip.x1 && shape.maxY >= clip.y0 &&
+            shape.minY <= clip.y1) {
+            order.push_back(&shape);
+            maxY = std::max(maxY, shape.maxY);
+        }
+    }
+    if (order.empty()) {
+        return;
+    }
+    std::sort(order.begin(), order.end(),
+              [](const Shape* a, const Shape* b) { return a->minY < b->minY; });
+
+    int const y0 = std::max(clip.y0, int(floorf(order[0]->minY)));
+    int const y1 = std::min(clip.y1, int(ceilf(maxY)) + 1);
+
+    std::vector<const Shape*>& active = scratch.active;
+    active.clear();
+    std::vector<PixelRange>& ranges = scratch.ranges;
+    std::vector<uint8_t>& coverage = scratch.coverage;
+    if (style.antialias) {
+        coverage.assign(clip.Width(), 0);
+    }
+
+    size_t next = 0;
+    for (int y = y0; y < y1; y++) {
+        float const py = y + 0.5f;
+        while (next < order.size() && order[next]->minY <= py) {
+            active.push_back(order[next++]);
+        }
+        std::erase_if(active, [py](const Shape* shape) { return shape->maxY < py; });
+        uint32_t* dst = target.pixels + y * target.stride;
+
+        if (!style.antialias && IsOpaqueBlend(color, mode)) {
+            // Where pieces overlap they write the same value, so they can skip the merge below
+            for (const Shape* shape : active) {
+                int x0, x1;
+                if (shape->PixelSpan(y, 0.0f, clip, x0, x1)) {
+                    FillSpan(dst + x0, EncodeColor(color), x1 - x0 + 1);
+                }
+            }
+            continue;
+        }
+
+        if (!style.antialias) {
+            // Merge the pieces' spans so overlapping pixels are blended once
+            ranges.clear();
+            for (const Shape* shape : active) {
+                PixelRange range;
+                if (shape->PixelSpan(y, 0.0f, clip, range.x0, range.x1)) {
+                    ranges.push_back(range);
+                }
+            }
+            std::sort(ranges.begin(), ranges.end(),
+                      [](PixelRange a, PixelRange b) { return a.x0 < b.x0; });
+            for (size_t i = 0; i < ranges.size();) {
+                PixelRange merged = ranges[i++];
+                while (i < ranges.size() && ranges[i].x0 <= merged.x1 + 1) {
+                    merged.x1 = std::max(merged.x1, ranges[i++].x1);
+                }
+                FillCoverageSpan(dst + merged.x0, merged.x1 - merged.x0 + 1, 255, color, mode);
+            }
+            continue;
+        }
+
+        // Accumulate the row's coverage over all pieces, then write each pixel once
+        uint8_t* row = coverage.data() - clip.x0;
+        int rowX0 = clip.x1;
+        int rowX1 = clip.x0 - 1;
+        for (const Shape* shape : active) {
+            int x0, x1;
+            if (!shape->PixelSpan(y, margin, clip, x0, x1)) {
+                continue;
+            }
+            rowX0 = std::min(rowX0, x0);
+            rowX1 = std::max(rowX1, x1);
+
+            // Pixels at least half a pixel inside are fully covered, only the edges need the
+            // distance
+            int inner0, inner1;
+            if (!shape->PixelSpan(y, -0.5f, clip, inner0, inner1)) {
+                inner0 = x1 + 1;
+                inner1 = x1;
+            }
+            for (int x = x0; x <= x1; x++) {
+                if (x == inner0) {
+                    memset(row + inner0, 255, inner1 - inner0 + 1);
+                    x = inner1;
+                    continue;
+                }
+                float const c = 0.5f - shape->Distance(x + 0.5f, py);
+                auto const value = uint8_t(std::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f);
+                row[x] = std::max(row[x], value);
+            }
+        }
+
+        for (int x = rowX0; x <= rowX1;) {
+            // Rows of long polylines are mostly empty, skip 8 uncovered pixels at a time
+            uint64_t word;
+            if (x + 8 <= rowX1 && (memcpy(&word, row + x, 8), word == 0)) {
+                x += 8;
+                continue;
+            }
+            uint8_t const value = row[x];
+            int end = x + 1;
+            while (end <= rowX1 && row[end] == value) {
+                end++;
+            }
+            if (value != 0) {
+                FillCoverageSpan(dst + x, end - x, value, color, mode);
+            }
+            x = end;
+        }
+        if (rowX0 <= rowX1) {
+            memset(row + rowX0, 0, rowX1 - rowX0 + 1);
+        }
+    }
+}
+
+Rect StrokeBounds(const Point* points, int count, StrokeStyle const& style) {
+    if (count <= 0) {
+        return {0, 0, 0, 0};
+    }
+
+    int minX = points[0].x;
+    int minY = points[0].y;
+    int maxX = points[0].x;
+    int maxY = points[0].y;
+    for (int i = 1; i < count; i++) {
+        minX = std::min(minX, points[i].x);
+        minY = std::min(minY, points[i].y);
+        maxX = std::max(maxX, points[i].x);
+        maxY = std::max(maxY, points[i].y);
+    }
+
+    // A square cap's corner lies width / sqrt(2) from its point, the antialiased edge half a pixel
+    // beyond that; one more pixel absorbs rounding
+    float const reach = std::max(style.width, 1) * 0.7072f + (style.antialias ? 0.5f : 0.0f);
+    int const pad = int(ceilf(reach)) + 1;
+    return {minX - pad, minY - pad, maxX + pad + 1, maxY + pad + 1};
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "blend.h"
+#include "color.h"
+#include "raster.h"
+#include "rect.h"
+
+// How consecutive segments of a polyline are connected on the outside of a turn
+enum class LineJoin : uint8_t {
+    None,  // segments just overlap, leaving a notch on sharp turns
+    Bevel, // the notch is filled with a straight edge
+    Round, // the notch is filled with a circular arc
+};
+
+struct StrokeStyle {
+    int width = 1;
+    LineJoin join = LineJoin::Bevel;
+    // Shades edge pixels by how much of them the stroke covers, instead of all or nothing
+    bool antialias = false;
+};
+
+// Strokes the polyline through `points` with square end caps. Points are pixel coordinates and the
+// stroke is centered on the pixel centers, so an odd width on a horizontal or vertical line covers
+// exactly `width` rows or columns.
+//
+// The stroke is rasterized as the union of one convex shape per segment and join, scanline by
+// scanline, so every covered pixel is written exactly once no matter how much the pieces overlap.
+// With antialiasing, `color.a` is scaled by coverage and Replace blends the partially covered edges
+// like SrcOver.
+void RasterStroke(const RasterTarget& target, const Point* points, int count,
+                  StrokeStyle const& style, Color color, BlendMode mode);
+
+// Everything RasterStroke may write for the same arguments
+Rect StrokeBounds(const Point* points, int count, StrokeStyle const& style);
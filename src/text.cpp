@@ -0,0 +1,71 @@
+#include <algorithm>
+
+#include "text.h"
+
+FontMetrics GetFontMetrics(FT_Face face) {
+    FT_Size_Metrics const& metrics = face->size->metrics;
+    FontMetrics result;
+    // 26.6 fixed point; ascent and descent round outwards so nothing sticks out of the line
+    result.ascent = int((metrics.ascender + 63) >> 6);
+    result.descent = int((-metrics.descender + 63) >> 6);
+    result.lineHeight = std::max(int((metrics.height + 32) >> 6), result.ascent + result.descent);
+    result.lineGap = result.lineHeight - result.ascent - result.descent;
+    return result;
+}
+
+template <typename Next>
+static TextMetrics Measure(Next&& next, FT_Face face) {
+    FontMetrics const font = GetFontMetrics(face);
+    TextMetrics result{0, 0, font.ascent, font.descent, font.lineGap, font.lineHeight, 1};
+    TextPen pen{face};
+
+    GlyphCache& cache = GlyphCache::Shared();
+    auto const lock = cache.Lock();
+
+    char32_t codepoint;
+    while (next(codepoint)) {
+        if (codepoint == U'\n') {
+            pen.NewLine();
+            result.lines++;
+            continue;
+        }
+
+        // Skipped while drawing too
+        const GlyphMetrics& glyph = cache.FindMetrics(face, codepoint);
+        if (!glyph.valid)
+            continue;
+
+        int originX;
+        pen.Advance(glyph.index, glyph.advance, originX);
+        result.width = std::max(result.width, pen.X());
+    }
+
+    result.height = font.ascent + font.descent + (result.lines - 1) * font.lineHeight;
+    return result;
+}
+
+TextMetrics MeasureText(std::string_view txt, FT_Face face) {
+    size_t pos = 0;
+    return Measure(
+        [&](char32_t& codepoint) {
+            if (pos == txt.size()) {
+                return false;
+            }
+            codepoint = DecodeUtf8(txt, pos);
+            return true;
+        },
+        face);
+}
+
+TextMetrics MeasureText(std::span<const char32_t> codepoints, FT_Face face) {
+    size_t index = 0;
+    return Measure(
+        [&](char32_t& codepoint) {
+            if (index == codepoints.size()) {
+                return false;
+            }
+            codepoint = codepoints[index++];
+            return true;
+        },
+        face);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+#include <proto-include.h>
+
+#include "glyph_cache.h"
+#include "types.h"
+#include "utf8.h"
+
+// Vertical metrics of a face at its current pixel size, in whole pixels
+struct FontMetrics {
+    int ascent;     // from the baseline up to the top of the tallest glyphs
+    int descent;    // from the baseline down to the bottom of the lowest glyphs, positive
+    int lineGap;    // extra space the font wants between lines
+    int lineHeight; // from one baseline to the next: ascent + descent + lineGap
+};
+
+FontMetrics GetFontMetrics(FT_Face face);
+
+// The size of a block of text, as the pen would lay it out
+struct TextMetrics {
+    int width;  // of the longest line, in pen advance
+    int height; // from the top of the first line to the bottom of the last one
+    int ascent;
+    int descent;
+    int lineGap;
+    int lineHeight;
+    int lines;
+};
+
+// Measures text from glyph metrics alone, without rendering any bitmap. The first line's
+// baseline is `ascent` below the top of the block, each further line adds `lineHeight`.
+TextMetrics MeasureText(std::string_view txt, FT_Face face);
+TextMetrics MeasureText(std::span<const char32_t> codepoints, FT_Face face);
+
+// Places glyphs one after another along a line, left to right from the pen position on the
+// baseline, kerning pairs if the face has a kerning table. NewLine moves down by the face's line
+// height.
+class TextPen {
+public:
+    explicit TextPen(FT_Face face)
+        : face(face), lineHeight(GetFontMetrics(face).lineHeight), kerning(FT_HAS_KERNING(face)) {}
+
+    // Moves the pen to the start of the next line. Callers handle U'\n' with this before looking
+    // a glyph up, newlines have none to find.
+    void NewLine() {
+        this->penX = 0;
+        this->penY += this->lineHeight;
+        this->previous = 0;
+    }
+
+    // Moves the pen past the glyph `index`; originX is where the glyph's origin goes on the line,
+    // relative to where the pen started
+    void Advance(u32 index, int advance, int& originX) {
+        if (this->kerning && this->previous != 0 && index != 0) {
+            FT_Vector delta{};
+            FT_Get_Kerning(this->face, this->previous, index, FT_KERNING_DEFAULT, &delta);
+            this->penX += int(delta.x >> 6);
+        }
+        this->previous = index;
+        originX = this->penX;
+        this->penX += advance;
+    }
+
+    // Same, with (x, y) where the top-left corner of the glyph's bitmap goes
+    void Advance(const CachedGlyph& glyph, int& x, int& y) {
+        int originX;
+        Advance(glyph.index, glyph.advance, originX);
+        x = originX + glyph.left;
+        y = this->penY - glyph.top;
+    }
+
+    int X() const {
+        return this->penX;
+    }
+    int Y() const {
+        return this->penY;
+    }
+
+private:
+    FT_Face face;
+    int lineHeight;
+    bool kerning;
+    u32 previous = 0; // glyph index, 0 at the start of a line
+    int penX = 0;
+    int penY = 0;
+};
+
+// Walks the codepoints produced by next(char32_t& codepoint), which returns false at the end,
+// looking each glyph up in the shared glyph cache and calling fn(const CachedGlyph& glyph, int x,
+// int y) with the screen position of its top-left corner. The glyph's coverage is only valid
+// during the call.
+template <typename Next, typename Fn>
+void RenderCodepoints(Next&& next, FT_Face face, int startX, int startY, Fn&& fn) {
+    TextPen pen{face};
+
+    // Held for the whole string, so no other thread can evict a glyph while fn reads it
+    GlyphCache& cache = GlyphCache::Shared();
+    auto const lock = cache.Lock();
+
+    // Iterate each character of the text to write to the screen
+    char32_t codepoint;
+    while (next(codepoint)) {
+        if (codepoint == U'\n') {
+            pen.NewLine();
+            continue;
+        }
+
+        const CachedGlyph& glyph = cache.Find(face, codepoint);
+        if (!glyph.valid)
+            continue;
+
+        int x, y;
+        pen.Advance(glyph, x, y);
+        fn(glyph, startX + x, startY + y);
+    }
+}
+
+// UTF-8 text, decoded as it is walked
+template <typename Fn>
+void RenderGlyphs(std::string_view txt, FT_Face face, int startX, int startY, Fn&& fn) {
+    size_t pos = 0;
+    auto const next = [&](char32_t& codepoint) {
+        if (pos == txt.size()) {
+            return false;
+        }
+        codepoint = DecodeUtf8(txt, pos);
+        return true;
+    };
+    RenderCodepoints(next, face, startX, startY, fn);
+}
+
+template <typename Fn>
+void RenderGlyphs(std::span<const char32_t> codepoints, FT_Face face, int startX, int startY,
+                  Fn&& fn) {
+    size_t index = 0;
+    auto const next = [&](char32_t& codepoint) {
+        if (index == codepoints.size()) {
+            return false;
+        }
+        codepoint = codepoints[index++];
+        return true;
+    };
+    RenderCodepoints(next, face, startX, startY, fn);
+}
@@ -0,0 +1,136 @@
+#include <string.h>
+
+#include "glyph_cache.h"
+#include "text.h"
+#include "text_layout.h"
+#include "utf8.h"
+
+static u32 PixelSize(FT_Face face) {
+    FT_Size_Metrics const& metrics = face->size->metrics;
+    return u32(metrics.x_ppem) << 16 | metrics.y_ppem;
+}
+
+TextLayout::TextLayout(std::string_view txt, FT_Face face) {
+    build(DecodeUtf8(txt), face);
+}
+
+TextLayout::TextLayout(std::span<const char32_t> codepoints, FT_Face face) {
+    build(codepoints, face);
+}
+
+void TextLayout::build(std::span<const char32_t> codepoints, FT_Face face) {
+    TextPen pen{face};
+    this->lines.push_back({0, 0, 0, 0});
+
+    GlyphCache& cache = GlyphCache::Shared();
+    auto const lock = cache.Lock();
+    for (char32_t const codepoint : codepoints) {
+        if (codepoint == U'\n') {
+            pen.NewLine();
+            this->lines.push_back({u32(this->glyphs.size()), 0, pen.Y(), 0});
+            continue;
+        }
+
+        const CachedGlyph& glyph = cache.Find(face, codepoint);
+        if (!glyph.valid) {
+            continue;
+        }
+
+        int x, y;
+        pen.Advance(glyph, x, y);
+        this->lines.back().width = pen.X();
+        if (glyph.width == 0 || glyph.height == 0) {
+            continue;
+        }
+
+        // Copy the coverage out of the cache, packed without padding
+        u32 const offset = u32(this->coverage.size());
+        this->coverage.resize(offset + size_t(glyph.width) * glyph.height);
+        for (int row = 0; row < glyph.height; row++) {
+            memcpy(this->coverage.data() + offset + size_t(row) * glyph.width,
+                   glyph.coverage + size_t(row) * glyph.pitch, glyph.width);
+        }
+
+        Rect const rect = Rect::FromSize(x, y, glyph.width, glyph.height);
+        this->bounds = this->glyphs.empty() ? rect : this->bounds.Union(rect);
+        this->glyphs.push_back({x, y, glyph.width, glyph.height, offset});
+        this->lines.back().glyphCount++;
+    }
+}
+
+size_t TextLayout::SizeBytes() const {
+    return sizeof(*this) + this->glyphs.capacity() * sizeof(Glyph) +
+           this->lines.capacity() * sizeof(Line) + this->coverage.capacity();
+}
+
+void TextLayout::Raster(const RasterTarget& target, int x, int y, Color fgColor, Color bgColor,
+                        BlendMode mode) const {
+    if (this->bounds.Translate(x, y).Intersect(target.clip).Empty()) {
+        return;
+    }
+    for (const Glyph& glyph : this->glyphs) {
+        RasterGlyph(target, this->coverage.data() + glyph.offset, glyph.width, glyph.height,
+                    glyph.width, x + glyph.x, y + glyph.y, fgColor, bgColor, mode);
+    }
+}
+
+const TextLayout& TextLayoutCache::Get(std::string_view txt, FT_Face face) {
+    u32 const pixelSize = PixelSize(face);
+    u64 hash = std::hash<std::string_view>{}(txt);
+    hash = (hash ^ reinterpret_cast<uintptr_t>(face)) * 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ pixelSize) * 0x9E3779B97F4A7C15ull;
+
+    auto [first, last] = this->index.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        Entry& entry = *it->second;
+        if (entry.face == face && entry.pixelSize == pixelSize && entry.text == txt) {
+            this->hits++;
+            this->entries.splice(this->entries.begin(), this->entries, it->second);
+            return entry.layout;
+        }
+    }
+
+    this->misses++;
+    this->entries.push_front({hash, std::string(txt), face, pixelSize, TextLayout(txt, face)});
+    this->index.emplace(hash, this->entries.begin());
+    this->bytes += this->entries.front().layout.SizeBytes();
+    return this->entries.front().layout;
+}
+
+void TextLayoutCache::Trim() {
+    while (this->bytes > this->memoryLimit && !this->entries.empty()) {
+        auto const oldest = std::prev(this->entries.end());
+        auto [first, last] = this->index.equal_range(oldest->hash);
+        for (auto it = first; it != last; ++it) {
+            if (it->second == oldest) {
+                this->index.erase(it);
+                break;
+            }
+        }
+        this->bytes -= oldest->layout.SizeBytes();
+        this->entries.erase(oldest);
+        this->evictions++;
+    }
+}
+
+void TextLayoutCache::Forget(FT_Face face) {
+    for (auto it = this->index.begin(); it != this->index.end();) {
+        if (it->second->face == face) {
+            this->bytes -= it->second->layout.SizeBytes();
+            this->entries.erase(it->second);
+            it = this->index.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void TextLayoutCache::Clear() {
+    this->index.clear();
+    this->entries.clear();
+    this->bytes = 0;
+}
+
+TextLayoutCacheStats TextLayoutCache::Stats() const {
+    return {this->hits, this->misses, this->evictions, this->entries.size(), this->bytes};
+}
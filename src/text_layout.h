@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <proto-include.h>
+
+#include "blend.h"
+#include "color.h"
+#include "raster.h"
+#include "rect.h"
+#include "types.h"
+
+// TextLayout is a string laid out once: every glyph positioned relative to the origin (where the
+// pen starts on the first baseline), split into lines, with a copy of its coverage. Drawing it is
+// only a blit of each glyph, with no decoding, glyph lookups or FreeType involved. The layout
+// uses the face's pixel size at construction and doesn't refer to the face afterwards.
+class TextLayout {
+public:
+    struct Glyph {
+        int x, y; // of the bitmap's top-left corner
+        int width, height;
+        u32 offset; // of the coverage, which is packed with a pitch of `width`
+    };
+    struct Line {
+        u32 firstGlyph;
+        u32 glyphCount;
+        int baseline; // pen y
+        int width;    // pen advance
+    };
+
+    TextLayout() = default;
+    // `txt` is UTF-8
+    TextLayout(std::string_view txt, FT_Face face);
+    TextLayout(std::span<const char32_t> codepoints, FT_Face face);
+
+    std::span<const Glyph> Glyphs() const {
+        return this->glyphs;
+    }
+    std::span<const Line> Lines() const {
+        return this->lines;
+    }
+    // Everything the glyphs cover, relative to the origin
+    Rect Bounds() const {
+        return this->bounds;
+    }
+    size_t SizeBytes() const;
+
+    // Draws the layout with its origin at (x, y), see RasterGlyph
+    void Raster(const RasterTarget& target, int x, int y, Color fgColor, Color bgColor,
+                BlendMode mode) const;
+
+private:
+    void build(std::span<const char32_t> codepoints, FT_Face face);
+
+    std::vector<Glyph> glyphs;
+    std::vector<Line> lines;
+    std::vector<uint8_t> coverage;
+    Rect bounds{};
+};
+
+struct TextLayoutCacheStats {
+    u64 hits;
+    u64 misses;
+    u64 evictions;
+    size_t layouts;
+    size_t bytes;
+};
+
+// Keeps the layouts of strings drawn again and again (menu labels, headers), keyed by text, face
+// and pixel size, and evicts the least recently used once they take more than the memory limit.
+// Eviction only happens in Trim(), so a layout returned by Get stays valid until then; Scene2D
+// trims after every Flush, once nothing recorded refers to the layouts anymore.
+class TextLayoutCache {
+public:
+    static constexpr size_t DefaultMemoryLimit = size_t(2) << 20;
+
+    const TextLayout& Get(std::string_view txt, FT_Face face);
+
+    void Trim();
+    void Forget(FT_Face face);
+    void Clear();
+
+    void SetMemoryLimit(size_t bytes) {
+        this->memoryLimit = bytes;
+    }
+    TextLayoutCacheStats Stats() const;
+
+private:
+    struct Entry {
+        u64 hash;
+        std::string text;
+        FT_Face face;
+        u32 pixelSize;
+        TextLayout layout;
+    };
+
+    // Most recently used first
+    std::list<Entry> entries;
+    // By hash of text, face and pixel size; strings that collide share a bucket
+    std::unordered_multimap<u64, std::list<Entry>::iterator> index;
+    size_t bytes{};
+    size_t memoryLimit{DefaultMemoryLimit};
+    u64 hits{};
+    u64 misses{};
+    u64 evictions{};
+};
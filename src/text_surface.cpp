@@ -0,0 +1,60 @@
+#include <string.h>
+
+#include <algorithm>
+
+#include "raster.h"
+#include "text_layout.h"
+#include "text_surface.h"
+
+bool TextSurface::Update(std::string_view txt, FT_Face face, Color color) {
+    u32 const pixelSize = face->size->metrics.y_ppem;
+    if (this->valid && txt == this->text && face == this->face && pixelSize == this->pixelSize &&
+        PackColor(color) == PackColor(this->color)) {
+        return false;
+    }
+    this->text = txt;
+    this->face = face;
+    this->pixelSize = pixelSize;
+    this->color = color;
+    this->valid = true;
+
+    TextLayout const layout{txt, face};
+    this->bounds = layout.Bounds();
+    int const width = this->bounds.Width();
+    int const height = this->bounds.Height();
+    if (this->bounds.Empty()) {
+        this->bounds = {};
+        return true;
+    }
+    if (width > this->image.width || height > this->image.height) {
+        if (!this->image.Allocate(std::max(width, this->image.width),
+                                  std::max(height, this->image.height))) {
+            this->valid = false;
+            this->bounds = {};
+            return false;
+        }
+    }
+
+    uint32_t* const pixels = this->image.pixels;
+    int const stride = this->image.stride;
+    for (int y = 0; y < height; y++) {
+        memset(pixels + size_t(y) * stride, 0, size_t(width) * sizeof(uint32_t));
+    }
+
+    // Drawn premultiplied onto transparent black, the coverage ends up in the alpha channel and
+    // overlapping glyph edges combine the way they would on screen
+    Color const premultiplied{uint8_t((color.r * color.a + 127) / 255),
+                              uint8_t((color.g * color.a + 127) / 255),
+                              uint8_t((color.b * color.a + 127) / 255), color.a};
+    RasterTarget const target{pixels, stride, Rect::FromSize(0, 0, width, height)};
+    layout.Raster(target, -this->bounds.x0, -this->bounds.y0, premultiplied, {0, 0, 0, 0},
+                  BlendMode::PremulSrcOver);
+    return true;
+}
+
+void TextSurface::Clear() {
+    this->text.clear();
+    this->face = nullptr;
+    this->valid = false;
+    this->bounds = {};
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+
+#include <proto-include.h>
+
+#include "color.h"
+#include "image.h"
+#include "rect.h"
+#include "types.h"
+
+// TextSurface keeps a string rendered into an Image, with premultiplied alpha over a transparent
+// background, so a label that doesn't change costs one blit per frame instead of a glyph lookup
+// and coverage blend per glyph. Update re-renders it only when the text, the face, the face's
+// pixel size or the color changed; the image is grown when needed and otherwise reused.
+//
+// The surface remembers the face by address: after freeing a face, Clear surfaces that used it.
+class TextSurface {
+public:
+    // Renders `txt` (UTF-8) unless the surface already holds it with the same face, size and
+    // color. Returns whether it was rendered. In tiled mode the pixels of a drawn surface are
+    // read at Flush time, so it must not be updated in between.
+    bool Update(std::string_view txt, FT_Face face, Color color);
+    // Empties the surface, the next Update renders
+    void Clear();
+
+    // Everything the text covers, relative to the origin (where the pen starts on the first
+    // baseline)
+    Rect Bounds() const {
+        return this->bounds;
+    }
+    // The rendered text, exactly Bounds() in size
+    ImageView View() const {
+        return this->image.View().Sub(0, 0, this->bounds.Width(), this->bounds.Height());
+    }
+
+private:
+    std::string text;
+    FT_Face face{};
+    u32 pixelSize{};
+    Color color{};
+    bool valid{};
+
+    Image image;
+    Rect bounds{};
+};
@@ -0,0 +1,67 @@
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(int numWorkers) {
+    for (int i = 0; i < numWorkers; i++) {
+        workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock{mutex};
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(int count, const std::function<void(int)>& fn) {
+    if (count <= 0) {
+        return;
+    }
+
+    {
+        std::lock_guard lock{mutex};
+        job = &fn;
+        jobCount = count;
+        nextIndex = 0;
+        busyWorkers = (int)workers.size();
+        generation++;
+    }
+    wake.notify_all();
+
+    runJob();
+
+    std::unique_lock lock{mutex};
+    done.wait(lock, [this] { return busyWorkers == 0; });
+    job = nullptr;
+}
+
+void ThreadPool::runJob() {
+    for (int i = nextIndex++; i < jobCount; i = nextIndex++) {
+        (*job)(i);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    u64 seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock lock{mutex};
+            wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) {
+                return;
+            }
+            seenGeneration = generation;
+        }
+
+        runJob();
+
+        std::lock_guard lock{mutex};
+        if (--busyWorkers == 0) {
+            done.notify_one();
+        }
+    }
+}
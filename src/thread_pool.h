@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.h"
+
+// A fixed set of worker threads for data-parallel loops. The calling thread always takes part in
+// the work, so a pool with zero workers simply runs everything inline.
+class ThreadPool {
+public:
+    explicit ThreadPool(int numWorkers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int NumWorkers() const {
+        return (int)workers.size();
+    }
+
+    // Calls fn(i) for every i in [0, count), spread over the workers and the calling thread.
+    // Returns once all calls have finished.
+    void ParallelFor(int count, const std::function<void(int)>& fn);
+
+private:
+    void workerLoop();
+    void runJob();
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    const std::function<void(int)>* job{};
+    int jobCount{};
+    std::atomic<int> nextIndex{};
+    int busyWorkers{};
+    u64 generation{};
+    bool stopping{};
+};
@@ -0,0 +1,61 @@
+#include "tile_renderer.h"
+
+TileRenderer::TileRenderer(int width, int height, int numThreads)
+    : width(width), height(height), tilesX((width + TileSize - 1) / TileSize),
+      tilesY((height + TileSize - 1) / TileSize), bins(tilesX * tilesY),
+      pool(std::make_unique<ThreadPool>(std::max(numThreads - 1, 0))) {}
+
+void TileRenderer::bin(const DisplayList& list, size_t start) {
+    Rect const screen = {0, 0, width, height};
+    list.ForEach(
+        [&](uint32_t offset, const DisplayList::CommandHeader& header) {
+            Rect const bounds = header.bounds.Intersect(screen);
+            if (bounds.Empty()) {
+                return;
+            }
+
+            int const tx0 = bounds.x0 / TileSize;
+            int const ty0 = bounds.y0 / TileSize;
+            int const tx1 = (bounds.x1 - 1) / TileSize;
+            int const ty1 = (bounds.y1 - 1) / TileSize;
+            for (int ty = ty0; ty <= ty1; ty++) {
+                for (int tx = tx0; tx <= tx1; tx++) {
+                    bins[ty * tilesX + tx].push_back({&list, offset});
+                }
+            }
+            pending = true;
+        },
+        start);
+}
+
+void TileRenderer::Flush(uint32_t* pixels, int stride, Rect clip) {
+    if (!pending) {
+        return;
+    }
+
+    // Two pointers of captures fit in std::function without a heap allocation
+    RasterTarget const screen{pixels, stride, clip.Intersect({0, 0, width, height})};
+    pool->ParallelFor(tilesX * tilesY, [this, &screen](int tile) {
+        const std::vector<BinEntry>& entries = bins[tile];
+        if (entries.empty()) {
+            return;
+        }
+
+        int const tx = tile % tilesX;
+        int const ty = tile / tilesX;
+        Rect const tileRect = Rect::FromSize(tx * TileSize, ty * TileSize, TileSize, TileSize);
+        RasterTarget const target{screen.pixels, screen.stride, tileRect.Intersect(screen.clip)};
+        if (target.clip.Empty()) {
+            return;
+        }
+        for (const BinEntry& entry : entries) {
+            entry.list->Execute(entry.offset, target);
+        }
+    });
+
+    commands.Clear();
+    for (std::vector<BinEntry>& entries : bins) {
+        entries.clear();
+    }
+    pending = false;
+}
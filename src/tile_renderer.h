@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "display_list.h"
+#include "thread_pool.h"
+
+// TileRenderer defers draws instead of rasterizing them right away. Each command is binned into
+// the screen tiles its bounds overlap, and Flush rasterizes the tiles in parallel. Within a tile,
+// commands run in the order they were recorded, and tiles never share pixels, so the result is
+// identical to drawing everything immediately on one thread.
+class TileRenderer {
+public:
+    static constexpr int TileSize = 128;
+
+    // `numThreads` counts the thread calling Flush, which always helps rasterizing
+    TileRenderer(int width, int height, int numThreads);
+
+    // Records into the renderer's own display list with record(DisplayList&), then bins whatever
+    // was appended
+    template <typename Fn>
+    void Record(Fn&& record) {
+        size_t const start = commands.SizeBytes();
+        record(commands);
+        bin(commands, start);
+    }
+
+    // Bins every command of an external list, which must stay valid and unchanged until Flush
+    void Submit(const DisplayList& list) {
+        bin(list, 0);
+    }
+
+    // Rasterizes everything recorded or submitted into `pixels`, clipped to `clip`, and starts a
+    // new batch
+    void Flush(uint32_t* pixels, int stride, Rect clip);
+
+private:
+    struct BinEntry {
+        const DisplayList* list;
+        uint32_t offset;
+    };
+
+    void bin(const DisplayList& list, size_t start);
+
+    int width;
+    int height;
+    int tilesX;
+    int tilesY;
+
+    DisplayList commands;
+    // Commands overlapping each tile, in recording order
+    std::vector<std::vector<BinEntry>> bins;
+    bool pending{};
+
+    std::unique_ptr<ThreadPool> pool;
+};
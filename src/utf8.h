@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+// Decodes the codepoint starting at text[pos] and moves pos past it. Malformed or truncated
+// sequences, overlong encodings and surrogates decode to U+FFFD and skip a single byte, so
+// decoding always makes progress and resynchronizes on the next valid lead byte.
+constexpr char32_t DecodeUtf8(std::string_view text, size_t& pos) {
+    uint8_t const lead = uint8_t(text[pos]);
+    if (lead < 0x80) {
+        pos++;
+        return lead;
+    }
+
+    int length;
+    char32_t codepoint;
+    char32_t minimum; // anything below takes fewer bytes, and is overlong here
+    if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = lead & 0x1F;
+        minimum = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = lead & 0x0F;
+        minimum = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = lead & 0x07;
+        minimum = 0x10000;
+    } else {
+        pos++;
+        return kReplacementCharacter;
+    }
+
+    if (text.size() - pos < size_t(length)) {
+        pos++;
+        return kReplacementCharacter;
+    }
+    for (int i = 1; i < length; i++) {
+        uint8_t const continuation = uint8_t(text[pos + i]);
+        if ((continuation & 0xC0) != 0x80) {
+            pos++;
+            return kReplacementCharacter;
+        }
+        codepoint = (codepoint << 6) | (continuation & 0x3F);
+    }
+    if (codepoint < minimum || codepoint > 0x10FFFF ||
+        (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+        pos++;
+        return kReplacementCharacter;
+    }
+
+    pos += length;
+    return codepoint;
+}
+
+// Decodes a whole string, e.g. once for text that is drawn every frame
+inline std::u32string DecodeUtf8(std::string_view text) {
+    std::u32string codepoints;
+    codepoints.reserve(text.size());
+    for (size_t pos = 0; pos < text.size();) {
+        codepoints.push_back(DecodeUtf8(text, pos));
+    }
+    return codepoints;
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+
+#include "assert.h"
+#include "logging.h"
+#include "video_memory.h"
+
+static uintptr_t AlignAddress(uintptr_t address, size_t alignment) {
+    return (address + alignment - 1) & ~uintptr_t(alignment - 1);
+}
+
+void VideoMemoryAllocator::Reset(void* base, size_t size) {
+    *this = VideoMemoryAllocator{};
+    if (!base) {
+        return;
+    }
+
+    this->base = reinterpret_cast<uintptr_t>(base);
+    this->size = size;
+    this->freeBlocks.emplace(this->base, size);
+}
+
+void* VideoMemoryAllocator::Allocate(size_t size, size_t alignment, VideoMemoryTag tag) {
+    ASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0,
+               "Video memory alignment {} is not a power of two", alignment);
+    size = std::max(AlignAddress(size, Granularity), Granularity);
+
+    for (auto it = this->freeBlocks.begin(); it != this->freeBlocks.end(); ++it) {
+        auto const [start, length] = *it;
+        uintptr_t const end = start + length;
+        uintptr_t const address = AlignAddress(start, alignment);
+        if (address > end || end - address < size) {
+            continue;
+        }
+
+        // Whatever the block has before and after the allocation stays free
+        this->freeBlocks.erase(it);
+        if (address > start) {
+            this->freeBlocks.emplace(start, address - start);
+        }
+        if (address + size < end) {
+            this->freeBlocks.emplace(address + size, end - address - size);
+        }
+
+        this->allocations.emplace(address, Allocation{size, tag});
+        this->inUse += size;
+        this->peakInUse = std::max(this->peakInUse, this->inUse);
+        this->inUseByTag[int(tag)] += size;
+        this->allocationCount++;
+        return reinterpret_cast<void*>(address);
+    }
+
+    this->failures++;
+    LOG_ERROR("Out of video memory: {} KiB requested, {} KiB free in {} blocks", size / 1024,
+              Stats().free / 1024, this->freeBlocks.size());
+    return nullptr;
+}
+
+void VideoMemoryAllocator::Free(void* memory) {
+    if (!memory) {
+        return;
+    }
+
+    auto const found = this->allocations.find(reinterpret_cast<uintptr_t>(memory));
+    ASSERT_MSG(found != this->allocations.end(), "{} is not an allocated block of video memory",
+               memory);
+    uintptr_t start = found->first;
+    size_t length = found->second.size;
+    this->inUse -= length;
+    this->inUseByTag[int(found->second.tag)] -= length;
+    this->allocations.erase(found);
+
+    // Merge with the free blocks right after and right before
+    auto next = this->freeBlocks.lower_bound(start);
+    if (next != this->freeBlocks.end() && next->first == start + length) {
+        length += next->second;
+        next = this->freeBlocks.erase(next);
+    }
+    if (next != this->freeBlocks.begin()) {
+        auto const previous = std::prev(next);
+        if (previous->first + previous->second == start) {
+            start = previous->first;
+            length += previous->second;
+            this->freeBlocks.erase(previous);
+        }
+    }
+    this->freeBlocks.emplace(start, length);
+}
+
+VideoMemoryStats VideoMemoryAllocator::Stats() const {
+    VideoMemoryStats stats{};
+    stats.size = this->size;
+    stats.inUse = this->inUse;
+    stats.peakInUse = this->peakInUse;
+    for (auto const& [start, length] : this->freeBlocks) {
+        stats.free += length;
+        stats.largestFree = std::max(stats.largestFree, length);
+    }
+    stats.freeBlocks = this->freeBlocks.size();
+    std::copy_n(this->inUseByTag, VideoMemoryTagCount, stats.inUseByTag);
+    stats.allocations = this->allocationCount;
+    stats.failures = this->failures;
+    return stats;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+
+#include "types.h"
+
+// What a block of video memory is used for, to account for it separately
+enum class VideoMemoryTag : uint8_t {
+    FrameBuffer,
+    Layer, // offscreen surfaces
+    Image, // GPU-visible images
+    Other,
+};
+inline constexpr int VideoMemoryTagCount = 4;
+
+struct VideoMemoryStats {
+    size_t size;        // of the whole region
+    size_t inUse;       // by live allocations, alignment padding excluded
+    size_t peakInUse;
+    size_t free;        // in free blocks, alignment padding included
+    size_t largestFree; // the biggest block a single allocation can still get
+    size_t freeBlocks;
+    size_t inUseByTag[VideoMemoryTagCount];
+    u64 allocations;
+    u64 failures; // allocations that didn't fit
+};
+
+// VideoMemoryAllocator manages the region of video memory Scene2D gets from its display backend,
+// so frame buffers, layers and images can come and go while the renderer runs. Blocks are
+// placed first fit, by address, and freed blocks are merged with free neighbors right away.
+// Sizes are rounded up to Granularity, so free blocks never get too small to be useful.
+//
+// Like Scene2D it is not thread safe.
+class VideoMemoryAllocator {
+public:
+    static constexpr size_t Granularity = 256;
+
+    // Manages `size` bytes at `base`, forgetting any previous region and its allocations.
+    // A null base leaves the allocator empty.
+    void Reset(void* base, size_t size);
+
+    // Returns `size` bytes aligned to `alignment` (a power of two), or null if no free block
+    // is big enough
+    void* Allocate(size_t size, size_t alignment, VideoMemoryTag tag);
+    // Returns a block from Allocate to the free pool; null is ignored
+    void Free(void* memory);
+
+    VideoMemoryStats Stats() const;
+
+private:
+    struct Allocation {
+        size_t size;
+        VideoMemoryTag tag;
+    };
+
+    uintptr_t base{};
+    size_t size{};
+    // By address
+    std::map<uintptr_t, size_t> freeBlocks;
+    std::map<uintptr_t, Allocation> allocations;
+
+    size_t inUse{};
+    size_t peakInUse{};
+    size_t inUseByTag[VideoMemoryTagCount]{};
+    u64 allocationCount{};
+    u64 failures{};
+};
@@ -0,0 +1,141 @@
+#include <errno.h>
+#include <string.h>
+
+#include <string>
+
+#include "logging.h"
+#include "video_out.h"
+
+DisplayBackend* CreateDisplayBackend() {
+    return new VideoOutBackend();
+}
+
+VideoOutBackend::~VideoOutBackend() {
+    DeallocateVideoMem();
+}
+
+bool VideoOutBackend::Open() {
+    this->video = sceVideoOutOpen(ORBIS_VIDEO_USER_MAIN, ORBIS_VIDEO_OUT_BUS_MAIN, 0, 0);
+
+    if (this->video < 0) {
+        LOG_DEBUG("Failed to open a video out handle: {}", std::string(strerror(errno)));
+        return false;
+    }
+
+    if (!initFlipQueue()) {
+        LOG_DEBUG("Failed to initialize flip queue: {}", std::string(strerror(errno)));
+        return false;
+    }
+
+    sceVideoOutSetFlipRate(this->video, 0);
+    return true;
+}
+
+bool VideoOutBackend::initFlipQueue() {
+    int rc = sceKernelCreateEqueue(&flipQueue, "homebrew flip queue");
+
+    if (rc < 0)
+        return false;
+
+    sceVideoOutAddFlipEvent(flipQueue, this->video, 0);
+    return true;
+}
+
+void* VideoOutBackend::AllocateVideoMem(size_t size, int alignment) {
+    int rc;
+
+    // Align the allocation size
+    this->directMemAllocationSize = (size + alignment - 1) / alignment * alignment;
+
+    // Allocate memory for display buffer
+    rc = sceKernelAllocateDirectMemory(0, sceKernelGetDirectMemorySize(),
+                                       this->directMemAllocationSize, alignment, 3,
+                                       &this->directMemOff);
+
+    if (rc < 0) {
+        this->directMemAllocationSize = 0;
+        return nullptr;
+    }
+
+    // Map the direct memory
+    rc = sceKernelMapDirectMemory(&this->videoMem, this->directMemAllocationSize, 0x33, 0,
+                                  this->directMemOff, alignment);
+
+    if (rc < 0) {
+        sceKernelReleaseDirectMemory(this->directMemOff, this->directMemAllocationSize);
+
+        this->directMemOff = 0;
+        this->directMemAllocationSize = 0;
+
+        return nullptr;
+    }
+
+    return this->videoMem;
+}
+
+void VideoOutBackend::DeallocateVideoMem() {
+    // Free the direct memory
+    if (this->directMemOff)
+        sceKernelReleaseDirectMemory(this->directMemOff, this->directMemAllocationSize);
+
+    // Zero out metadata
+    this->videoMem = nullptr;
+    this->directMemOff = 0;
+    this->directMemAllocationSize = 0;
+}
+
+bool VideoOutBackend::RegisterBuffers(char** buffers, int num, int width, int height) {
+    // Set SRGB pixel format
+    sceVideoOutSetBufferAttribute(&this->attr, 0x80000000, 1, 0, width, height, width);
+
+    // Register the buffers to the video handle
+    int const rc = sceVideoOutRegisterBuffers(this->video, 0, (void**)buffers, num, &this->attr);
+    if (rc < 0) {
+        LOG_ERROR("Failed to register {} frame buffers: {:#x}", num, u32(rc));
+        return false;
+    }
+    this->bufferSet = rc;
+    return true;
+}
+
+void VideoOutBackend::UnregisterBuffers() {
+    if (this->bufferSet < 0) {
+        return;
+    }
+    sceVideoOutUnregisterBuffers(this->video, this->bufferSet);
+    this->bufferSet = -1;
+}
+
+bool VideoOutBackend::SubmitFlip(int index, s64 flipArg) {
+    int const rc = sceVideoOutSubmitFlip(this->video, index, ORBIS_VIDEO_OUT_FLIP_VSYNC, flipArg);
+    if (rc < 0) {
+        LOG_ERROR("Failed to submit flip {} of buffer {}: {:#x}", flipArg, index, u32(rc));
+        return false;
+    }
+    return true;
+}
+
+void VideoOutBackend::WaitFlip(s64 flipArg) {
+    OrbisKernelEvent evt;
+    int count;
+
+    // If the video handle is not initialized, bail out. This is mostly a failsafe, this should
+    // never happen.
+    if (this->video == 0)
+        return;
+
+    for (;;) {
+        OrbisVideoOutFlipStatus flipStatus;
+
+        // Get the flip status and check the arg for the given frame ID. With more than two
+        // buffers, later flips may already have been displayed by the time this is called.
+        sceVideoOutGetFlipStatus(video, &flipStatus);
+
+        if (flipStatus.flipArg >= flipArg)
+            break;
+
+        // Wait on next flip event
+        if (sceKernelWaitEqueue(this->flipQueue, &evt, 1, &count, 0) != 0)
+            break;
+    }
+}
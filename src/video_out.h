@@ -0,0 +1,38 @@
+#pragma once
+
+#include <orbis/VideoOut.h>
+#include <orbis/libkernel.h>
+
+#include "display_backend.h"
+
+// Presents frame buffers through sceVideoOut, backed by a direct memory allocation.
+class VideoOutBackend : public DisplayBackend {
+public:
+    VideoOutBackend() = default;
+    ~VideoOutBackend() override;
+
+    bool Open() override;
+
+    void* AllocateVideoMem(size_t size, int alignment) override;
+    void DeallocateVideoMem() override;
+
+    bool RegisterBuffers(char** buffers, int num, int width, int height) override;
+    void UnregisterBuffers() override;
+
+    bool SubmitFlip(int index, s64 flipArg) override;
+    void WaitFlip(s64 flipArg) override;
+
+private:
+    bool initFlipQueue();
+
+    int video{};
+
+    off_t directMemOff{};
+    size_t directMemAllocationSize{};
+    void* videoMem{};
+
+    OrbisKernelEqueue flipQueue{};
+    OrbisVideoOutBufferAttribute attr{};
+    // Returned by sceVideoOutRegisterBuffers, -1 while no buffers are registered
+    int bufferSet{-1};
+};